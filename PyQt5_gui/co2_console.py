@@ -12,7 +12,7 @@ except:
 
 from PyQt5 import QtWidgets, QtCore
 from PyQt5.QtCore import Qt, QThread, pyqtSignal
-from PyQt5.QtGui import QIcon, QTextCursor
+from PyQt5.QtGui import QIcon, QTextCursor, QImage, QPixmap
 from PyQt5.QtWidgets import (QMainWindow, QApplication, QAction, QWidget,
     qApp, QPushButton, QDesktopWidget, QHBoxLayout, QVBoxLayout, QLabel, QLineEdit, QTextEdit, QCheckBox, QComboBox )
 
@@ -28,6 +28,27 @@ import pyqtgraph as pg
 
 co2 = 455
 
+# Binary telemetry from the firmware (src/telemetry.c):
+#   COBS(type, seq, payload, crc16) 0x00
+# Multi-byte fields are little-endian, CRC is Modbus CRC16 over type, seq and
+# payload.
+TLM_SAMPLE, TLM_STATS, TLM_EVENT, TLM_OLED, TLM_BUS_SLAVE = 1, 2, 3, 4, 5
+TLM_TEMP_NA = -32768
+TLM_EVENTS = {1: "boot", 2: "sensor fault", 3: "sensor ok"}
+TLM_STATS_FIELDS = ("uptime", "bus_rate", "bus_requests", "bus_timeouts",
+                    "bus_errors", "line_errors", "rx_drops", "rx_hwm", "drops")
+TLM_BUS_SLAVE_FIELDS = ("sensor", "addr", "requests", "replies", "timeouts",
+                        "errors", "latency_last", "latency_min", "latency_max",
+                        "latency_avg")
+
+# Display mirror (src/oled_mirror.c): flags, offset (2), then tokens over the
+# framebuffer bytes (8 pages of 128 columns, bit 0 is the top pixel):
+#   0x00..0x7f: n + 1 bytes unchanged, 0x80..0xff: n + 1 XOR bytes follow
+OLED_WIDTH, OLED_HEIGHT = 128, 64
+OLED_RESET = 0x01
+OLED_SCALE = 2
+OLED_UPDATE = 100
+
 DISPLAY_UPDATE = 1000
 
 # Globals
@@ -35,7 +56,7 @@ WIN_WITH, WIN_HEIGHT = 684, 600     # Window size
 SER_TIMEOUT = 1.0                   # Time out for serial RX
 RETURN_CHAR = "\n"                  # Char to be sent when Enter key pressed
 PASTE_CHAR = "\x16"                 # Ctrl code for clipboard paste
-baudrate = 9600                     # Default boudrate
+baudrate = 115200                   # Default boudrate (host link)
 portname = "/dev/ttyUSB0"#"/dev/ttyACM0"                # Default port name
 hexmode = False                     # Flag to enable hex dispaly
 
@@ -63,6 +84,119 @@ def hexdump(data):
 def textdump(data):
     return "".join(["[%02X]" % ord(b) if b>'\x7e' else b for b in data])
 
+# Modbus CRC16 (polynomial 0xA001 reflected, init 0xFFFF)
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+# Decode COBS frame (without 0x00 delimiter); None if malformed
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+# Telemetry frame decoder; keeps counters of bad and lost frames
+class TelemetryDecoder:
+    def __init__(self):
+        self.seq = None
+        self.bad = 0
+        self.lost = 0
+
+    # Decode one frame (without delimiter) into (type, dict) or None
+    def decode(self, frame):
+        raw = cobs_decode(frame)
+        if raw is None or len(raw) < 4:
+            self.bad += 1
+            return None
+        crc, = struct.unpack('<H', raw[-2:])
+        if crc16(raw[:-2]) != crc:
+            self.bad += 1
+            return None
+        rtype, seq, payload = raw[0], raw[1], raw[2:-2]
+        if self.seq is not None:
+            self.lost += (seq - self.seq - 1) & 0xFF
+        self.seq = seq
+        try:
+            if rtype == TLM_SAMPLE:
+                sensor, co2, status, temp = struct.unpack('<BHHh', payload)
+                return rtype, {"sensor": sensor, "co2": co2, "status": status,
+                               "temp": None if temp == TLM_TEMP_NA else temp / 100.0}
+            if rtype == TLM_STATS:
+                return rtype, dict(zip(TLM_STATS_FIELDS,
+                                       struct.unpack('<IHIIIIIHI', payload)))
+            if rtype == TLM_EVENT:
+                code, arg = struct.unpack('<BI', payload)
+                return rtype, {"event": TLM_EVENTS.get(code, str(code)), "arg": arg}
+            if rtype == TLM_BUS_SLAVE:
+                return rtype, dict(zip(TLM_BUS_SLAVE_FIELDS,
+                                       struct.unpack('<BBIIIIIIII', payload)))
+            if rtype == TLM_OLED:
+                flags, offset = struct.unpack('<BH', payload[:3])
+                return rtype, {"flags": flags, "offset": offset,
+                               "tokens": payload[3:]}
+        except struct.error:
+            self.bad += 1
+            return None
+        return rtype, {"payload": payload}
+
+# Copy of the device display, rebuilt from mirror records
+class OledMirror:
+    def __init__(self):
+        self.fb = bytearray(OLED_WIDTH * OLED_HEIGHT // 8)
+        self.synced = False     # got a key frame since the last lost record
+        self.changed = False
+
+    def lost(self):
+        self.synced = False
+
+    # Apply one record; False if it is malformed
+    def apply(self, flags, offset, tokens):
+        if flags & OLED_RESET:
+            self.fb[:] = bytes(len(self.fb))
+            self.synced = True
+        i = 0
+        while i < len(tokens):
+            run = (tokens[i] & 0x7F) + 1
+            literal = tokens[i] & 0x80
+            i += 1
+            if offset + run > len(self.fb):
+                return False
+            if literal:
+                for b in tokens[i:i + run]:
+                    self.fb[offset] ^= b
+                    offset += 1
+                i += run
+            else:
+                offset += run
+        self.changed = True
+        return True
+
+    # Picture as 8-bit grayscale rows
+    def image(self):
+        rows = bytearray(OLED_WIDTH * OLED_HEIGHT)
+        for page in range(OLED_HEIGHT // 8):
+            base = page * OLED_WIDTH
+            for x in range(OLED_WIDTH):
+                b = self.fb[base + x]
+                if not b:
+                    continue
+                for bit in range(8):
+                    if b >> bit & 1:
+                        rows[(page * 8 + bit) * OLED_WIDTH + x] = 0xFF
+        return bytes(rows)
+
 # Display incoming serial data
 def display(s):
     if not hexmode:
@@ -101,6 +235,12 @@ class myWindow(QMainWindow):
         self.plot.showGrid(x=True, y=True) # show the grids  on the graph
 
         self.plot.setFixedHeight(200)
+
+        # Device display mirror
+        self.oled = OledMirror()
+        self.oledView = QLabel(self)
+        self.oledView.setFixedSize(OLED_WIDTH * OLED_SCALE, OLED_HEIGHT * OLED_SCALE)
+        self.oledView.setStyleSheet("background-color: black")
         self.plot.setBackground('w')
         pen = pg.mkPen(color=(255, 0, 0), width=2, style=Qt.DashLine)
 
@@ -185,6 +325,8 @@ class myWindow(QMainWindow):
         vbox1 = QVBoxLayout()
         vbox1.addWidget(terminalL)
         vbox1.addWidget(self.terminal)
+        vbox1.addWidget(QLabel("-------= Display =-------"))
+        vbox1.addWidget(self.oledView)
         vbox1.addStretch(1)
 
         hbox = QHBoxLayout()
@@ -221,6 +363,11 @@ class myWindow(QMainWindow):
         self.timer.timeout.connect(self.update_plot_data)
         self.timer.start()
 
+        self.oledTimer = QtCore.QTimer()
+        self.oledTimer.setInterval(OLED_UPDATE)
+        self.oledTimer.timeout.connect(self.update_oled)
+        self.oledTimer.start()
+
     def update_plot_data(self):
         self.x = self.x[1:]             # Remove the first y element.
         self.x.append(time.time())      # Add a new time value
@@ -229,6 +376,15 @@ class myWindow(QMainWindow):
         self.data_line.setData(self.x, self.y)  # Update the data.
 
 
+    def update_oled(self):
+        if not self.oled.changed:
+            return
+        self.oled.changed = False
+        img = QImage(self.oled.image(), OLED_WIDTH, OLED_HEIGHT, OLED_WIDTH,
+                     QImage.Format_Grayscale8)
+        self.oledView.setPixmap(QPixmap.fromImage(img).scaled(
+            OLED_WIDTH * OLED_SCALE, OLED_HEIGHT * OLED_SCALE))
+
     def center(self):
         qr = self.frameGeometry()
         cp = QDesktopWidget().availableGeometry().center()
@@ -252,7 +408,7 @@ class myWindow(QMainWindow):
 
     def serThConnect(self):
         self.connectAction.setEnabled(False)
-        self.serth = SerialThread(portname, int(self.serialBaudRate.text()))  # Start serial thread
+        self.serth = SerialThread(portname, int(self.serialBaudRate.text()), self.oled)  # Start serial thread
         self.serth.start()
 
     def changeHexMode(self, state):
@@ -297,9 +453,10 @@ class myWindow(QMainWindow):
 
 # Thread to handle incoming & outgoing serial data
 class SerialThread(QThread):
-    def __init__(self, portname, baudrate): # Initialise with serial port details
+    def __init__(self, portname, baudrate, oled): # Initialise with serial port details
         QThread.__init__(self)
         self.portname, self.baudrate = portname, baudrate
+        self.oled = oled
         self.txq = Queue.Queue()
         self.running = True
 
@@ -323,15 +480,40 @@ class SerialThread(QThread):
         if not self.ser:
             print("Can't open port")
             self.running = False
+        decoder = TelemetryDecoder()
         while self.running:
-            self.ser.read_until('\xFE') # wait until startof the sensore reply msg
-            s = self.ser.read(13)       # sensor reply message specific length
-            # s = self.ser.read(self.ser.in_waiting or 1)
-            if s:                                       # Get data from serial port
-                addr, register, length, status, hz, hz2, co2,  checksum = (struct.unpack('>ccHHHcHH', s))
-                self.ser_in(bytes_str(s))               # ..and convert to string
-               # sys.stdout.write('response: co2: ' + str(hex(co2)) + ' crc: ' + str(hex(checksum)) + '\n')
-                sys.stdout.write('response: co2: ' + str(co2) + '\n')
+            frame = self.ser.read_until(b'\x00')   # frames end with 0x00
+            if frame.endswith(b'\x00') and len(frame) > 1:
+                if hexmode:
+                    self.ser_in(bytes_str(frame))
+                lost = decoder.lost
+                rec = decoder.decode(frame[:-1])
+                if decoder.lost != lost or not rec:
+                    self.oled.lost()        # XOR deltas are off until key frame
+                if rec:
+                    rtype, fields = rec
+                    if rtype == TLM_SAMPLE:
+                        if fields["sensor"] == 0:
+                            co2 = fields["co2"]
+                        sys.stdout.write('sample: sensor %(sensor)d co2 %(co2)d '
+                                         'status %(status)d temp %(temp)s\n' % fields)
+                    elif rtype == TLM_STATS:
+                        sys.stdout.write('stats: ' + ', '.join('%s %d' % kv
+                                         for kv in fields.items()) +
+                                         ', lost %d, bad %d\n' % (decoder.lost, decoder.bad))
+                    elif rtype == TLM_BUS_SLAVE:
+                        sys.stdout.write('sensor %(sensor)d (addr %(addr)d): '
+                                         'requests %(requests)d replies %(replies)d '
+                                         'timeouts %(timeouts)d errors %(errors)d, '
+                                         'latency us last %(latency_last)d '
+                                         'min %(latency_min)d max %(latency_max)d '
+                                         'avg %(latency_avg)d\n' % fields)
+                    elif rtype == TLM_EVENT:
+                        sys.stdout.write('event: %(event)s (%(arg)d)\n' % fields)
+                    elif rtype == TLM_OLED:
+                        if fields["flags"] & OLED_RESET or self.oled.synced:
+                            if not self.oled.apply(**fields):
+                                self.oled.lost()
 
             if not self.txq.empty():
                 txd = str(self.txq.get())               # If Tx data in queue, write to serial port
@@ -0,0 +1,111 @@
+/**
+ * @file
+ *
+ * Text rendering benchmark: per-pixel glyph drawing vs page layout blitter
+ * vs glyphs unpacked on the fly (tools/font_compiler.py, raw and RLE).
+ *
+ * All paths draw the same strings; framebuffers are compared to make sure
+ * the output is identical.
+ */
+
+#include "../inc/oled_ssd1306.h"
+#include "stubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ITERATIONS	20000
+
+/* Generated by host/Makefile */
+extern font_def_t font_7x10_packed, font_7x10_rle;
+extern font_def_t font_16x26_packed, font_16x26_rle;
+
+struct bench_case {
+	const char *name;
+	font_def_t *font;
+	font_def_t *packed;
+	font_def_t *rle;
+	uint8_t x;
+	uint8_t y;
+	const char *str;
+};
+
+static struct bench_case cases[] = {
+	{ "16x26 digits, aligned", &font_16x26, &font_16x26_packed,
+	  &font_16x26_rle, 64, 0, "1234" },
+	{ "16x26 digits, y = 3", &font_16x26, &font_16x26_packed,
+	  &font_16x26_rle, 64, 3, "1234" },
+	{ "7x10 label, y = 27", &font_7x10, &font_7x10_packed,
+	  &font_7x10_rle, 0, 27, "Status:" },
+	{ "7x10 label, y = 48", &font_7x10, &font_7x10_packed,
+	  &font_7x10_rle, 0, 48, "Status:" },
+};
+
+/* Draw the string ITERATIONS times, alternating colors; return ns per string */
+static double run(oled_ssd1306_t *obj, const struct bench_case *c,
+		  font_def_t font)
+{
+	double t0, t1;
+	int i;
+
+	t0 = now_ns();
+	for (i = 0; i < ITERATIONS; i++) {
+		ssd1306_set_cursor(obj, c->x, c->y);
+		ssd1306_write_string(obj, (char *)c->str, font,
+				     (i & 1) ? BLACK : WHITE);
+	}
+	t1 = now_ns();
+
+	return (t1 - t0) / ITERATIONS;
+}
+
+/* Draw with the font from blank screen; compare with reference if given */
+static double check(oled_ssd1306_t *obj, const struct bench_case *c,
+		    font_def_t font, const uint8_t *ref, int *ret)
+{
+	double t;
+
+	ssd1306_fill(BLACK);
+	t = run(obj, c, font);
+
+	if (ref && memcmp(ref, ssd1306_get_buffer(), OLED_BUFF_LEN)) {
+		printf("%s: framebuffer mismatch\n", c->name);
+		*ret = EXIT_FAILURE;
+	}
+
+	return t;
+}
+
+int main(void)
+{
+	static uint8_t ref[OLED_BUFF_LEN];
+	oled_ssd1306_t obj = { 0 };
+	unsigned int i;
+	int ret = EXIT_SUCCESS;
+
+	ssd1306_init(&obj);
+
+	printf("%-24s %10s %10s %10s %10s\n", "case, ns per string", "pixel",
+	       "pages", "packed", "rle");
+
+	for (i = 0; i < ARRAY_SIZE(cases); i++) {
+		const struct bench_case *c = &cases[i];
+		font_def_t pixel = *c->font;
+		double t_pixel, t_pages, t_packed, t_rle;
+
+		pixel.pages = NULL;
+
+		t_pixel = check(&obj, c, pixel, NULL, &ret);
+		memcpy(ref, ssd1306_get_buffer(), sizeof(ref));
+
+		t_pages = check(&obj, c, *c->font, ref, &ret);
+		t_packed = check(&obj, c, *c->packed, ref, &ret);
+		t_rle = check(&obj, c, *c->rle, ref, &ret);
+
+		printf("%-24s %10.1f %10.1f %10.1f %10.1f\n", c->name, t_pixel,
+		       t_pages, t_packed, t_rle);
+	}
+
+	return ret;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file
+ *
+ * 2D primitives benchmark. Page-wise spans and rectangles are also checked
+ * against the same shapes drawn pixel by pixel, and the scrolling chart
+ * against the same samples drawn from scratch.
+ */
+
+#include "../inc/oled_ssd1306.h"
+#include "../inc/oled_chart.h"
+#include "stubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ITERATIONS	20000
+
+static oled_color_t color;
+
+static void draw_fill(void)
+{
+	ssd1306_fill(color);
+}
+
+static void draw_fill_rect(void)
+{
+	ssd1306_fill_rectangle(10, 3, 117, 60, color);
+}
+
+static void draw_rect(void)
+{
+	ssd1306_draw_rectangle(10, 3, 117, 60, color);
+}
+
+static void draw_lines(void)
+{
+	ssd1306_line(0, 0, 127, 63, color);
+	ssd1306_line(0, 63, 127, 0, color);
+	ssd1306_line(64, 0, 70, 63, color);
+}
+
+static void draw_circle(void)
+{
+	ssd1306_draw_circle(64, 32, 30, color);
+}
+
+static void draw_arc(void)
+{
+	ssd1306_draw_arc(64, 32, 30, 45, 270, color);
+}
+
+/* Trend chart: 128 samples, one polyline */
+static void draw_chart(void)
+{
+	static oledd_vertex_t pts[SSD1306_WIDTH];
+	unsigned int i;
+
+	if (!pts[1].x) {
+		for (i = 0; i < ARRAY_SIZE(pts); i++) {
+			pts[i].x = i;
+			pts[i].y = 40 + (i * 7919 % 23) - 11;
+		}
+	}
+
+	ssd1306_fill_rectangle(0, 16, 127, 63, BLACK);
+	ssd1306_polyline(pts, ARRAY_SIZE(pts), WHITE);
+}
+
+static struct oled_chart chart;
+
+/* CO2-like samples: slow drift, small noise, rare jumps */
+static uint16_t chart_sample(unsigned int n)
+{
+	return 800 + (n / 64) % 5 * 40 + (n * 7919 % 23);
+}
+
+/* Trend chart widget: one new sample, the plot scrolls */
+static void draw_chart_add(void)
+{
+	static unsigned int n;
+
+	oled_chart_add(&chart, chart_sample(n++));
+}
+
+static const struct {
+	const char *name;
+	void (*draw)(void);
+} cases[] = {
+	{ "fill", draw_fill },
+	{ "fill_rectangle 108x58", draw_fill_rect },
+	{ "draw_rectangle 108x58", draw_rect },
+	{ "3 lines", draw_lines },
+	{ "circle r = 30", draw_circle },
+	{ "arc r = 30, 270 deg", draw_arc },
+	{ "chart, 128 points", draw_chart },
+	{ "chart widget, 1 sample", draw_chart_add },
+};
+
+/* Page-wise rectangle must set exactly the same pixels as draw_pixel() */
+static int check_rect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+	static uint8_t ref[OLED_BUFF_LEN];
+	unsigned int x, y;
+	uint8_t ylo = (y1 < y2) ? y1 : y2, yhi = (y1 < y2) ? y2 : y1;
+
+	ssd1306_fill(BLACK);
+	for (y = ylo; y <= yhi && y < SSD1306_HEIGHT; y++)
+		for (x = x1; x <= x2 && x < SSD1306_WIDTH; x++)
+			ssd1306_draw_pixel(x, y, WHITE);
+	memcpy(ref, ssd1306_get_buffer(), sizeof(ref));
+
+	ssd1306_fill(BLACK);
+	ssd1306_fill_rectangle(x2, y2, x1, y1, WHITE);
+	if (memcmp(ref, ssd1306_get_buffer(), sizeof(ref))) {
+		printf("fill_rectangle(%u, %u, %u, %u) mismatch\n", x1, y1, x2,
+		       y2);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Incrementally scrolled chart must match the one drawn from scratch.
+ * Also count bus bytes per sample with screen updates.
+ */
+static int check_chart(uint8_t y, uint8_t h)
+{
+	static uint8_t ref[OLED_BUFF_LEN];
+	const unsigned int samples = 3 * SSD1306_WIDTH;
+	uint32_t bytes;
+	unsigned int n;
+
+	ssd1306_fill(BLACK);
+	oled_chart_init(&chart, 0, y, SSD1306_WIDTH, h, 50);
+	ssd1306_update_screen();
+
+	bytes = stub_i2c_bytes;
+	for (n = 0; n < samples; n++) {
+		oled_chart_add(&chart, chart_sample(n));
+		ssd1306_update_screen();
+	}
+	printf("chart y = %u, h = %u: %s scroll, %u bus bytes per sample\n",
+	       y, h, chart.hw_scroll ? "hardware" : "software",
+	       (unsigned int)((stub_i2c_bytes - bytes) / samples));
+	memcpy(ref, ssd1306_get_buffer(), sizeof(ref));
+
+	oled_chart_redraw(&chart);
+	if (memcmp(ref, ssd1306_get_buffer(), sizeof(ref))) {
+		printf("chart: scrolled plot differs from redrawn one\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	oled_ssd1306_t obj = { 0 };
+	unsigned int i, n;
+	int ret = EXIT_SUCCESS;
+	double t0;
+
+	ssd1306_init(&obj);
+
+	for (i = 0; i < 64; i++) {
+		if (check_rect(i, i, i + 40, i + i % 9) ||
+		    check_rect(0, i, 127, 63 - i % 32) ||
+		    check_rect(100, i, 200, 255))
+			ret = EXIT_FAILURE;
+	}
+
+	if (check_chart(37, 27) || check_chart(40, 24))
+		ret = EXIT_FAILURE;
+	oled_chart_init(&chart, 0, 37, SSD1306_WIDTH, 27, 50);
+
+	printf("%-24s %12s\n", "case", "ns per draw");
+	for (i = 0; i < ARRAY_SIZE(cases); i++) {
+		ssd1306_fill(BLACK);
+		t0 = now_ns();
+		for (n = 0; n < ITERATIONS; n++) {
+			color = (n & 1) ? BLACK : WHITE;
+			cases[i].draw();
+		}
+		printf("%-24s %12.1f\n", cases[i].name,
+		       (now_ns() - t0) / ITERATIONS);
+	}
+
+	return ret;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file
+ *
+ * Pseudo-grayscale on the SSD1306 emulator: bars of the 4 shades and a
+ * trend chart with a confidence band are drawn into the planes, the plane
+ * timer is fired and what the panel shows is averaged over the ticks, as
+ * the eye does. The bars must come out as 4 distinct levels, in order.
+ * The averaged picture is saved as gray.png to the directory given in the
+ * command line (current one by default).
+ *
+ * Bus cost per plane is measured on the stubbed I2C bus and converted to
+ * max plane rate for I2C and SPI transports.
+ */
+
+#include "../inc/oled_gray.h"
+#include "../inc/oled_ssd1306.h"
+#include "ssd1306_emu.h"
+#include "stubs.h"
+
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/timer.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TICKS		64	/* even: both planes shown equally */
+#define PNG_SCALE	4
+
+#define BAR_H		16
+#define BAR_W		(SSD1306_WIDTH / OLED_GRAY_SHADES)
+#define CHART_MID	42
+
+#define I2C_HZ		400000
+#define I2C_BITS	9	/* per byte, with ACK */
+#define SPI_HZ		9000000
+/* Plane on SPI: contrast and address commands, then data */
+#define SPI_PLANE_BYTES	(8 + OLED_BUFF_LEN)
+
+static uint32_t acc[EMU_HEIGHT][EMU_WIDTH];
+
+/* Sample trend: triangle wave around CHART_MID, band widens to the right */
+static void draw_chart(void)
+{
+	uint8_t x, mean, w;
+
+	for (x = 0; x < SSD1306_WIDTH; x += 4) {
+		oled_gray_pixel(x, CHART_MID - 10, 2);
+		oled_gray_pixel(x, CHART_MID + 10, 2);
+	}
+
+	for (x = 0; x < SSD1306_WIDTH; x++) {
+		mean = CHART_MID + abs(x % 40 - 20) / 2 - 5;
+		w = 2 + x / 32;
+		oled_gray_vline(x, mean - w, mean + w, 1);
+		oled_gray_pixel(x, mean, 3);
+	}
+}
+
+static void draw(void)
+{
+	uint8_t s;
+
+	oled_gray_fill(0);
+	for (s = 0; s < OLED_GRAY_SHADES; s++) {
+		oled_gray_fill_rect(s * BAR_W, 0, (s + 1) * BAR_W - 1,
+				    BAR_H - 1, s);
+	}
+	draw_chart();
+}
+
+/* Mean brightness in the middle of the bar */
+static double bar_level(uint8_t s)
+{
+	uint32_t sum = 0;
+	int x, y, n = 0;
+
+	for (y = 4; y < BAR_H - 4; y++) {
+		for (x = s * BAR_W + 4; x < (s + 1) * BAR_W - 4; x++) {
+			sum += acc[y][x];
+			n++;
+		}
+	}
+
+	return (double)sum / n / TICKS;
+}
+
+int main(int argc, char *argv[])
+{
+	const struct swtimer_hw_tim hw_tim = {
+		.base = TIM3,
+		.irq = NVIC_TIM3_IRQ,
+	};
+	oled_ssd1306_t obj = { 0 };
+	struct oled_gray_stats stats;
+	static emu_image_t img;
+	const char *out_dir = argc > 1 ? argv[1] : ".";
+	char path[256];
+	double level, prev = 0.0, bytes;
+	int ret = EXIT_SUCCESS;
+	unsigned int t, x, y;
+	uint32_t bytes0;
+	uint8_t s;
+
+	ssd1306_init(&obj);
+	if (oled_gray_init(&hw_tim)) {
+		printf("Can't init grayscale\n");
+		return EXIT_FAILURE;
+	}
+
+	draw();
+	oled_gray_start();
+	bytes0 = stub_i2c_bytes;
+
+	for (t = 0; t < TICKS; t++) {
+		stub_irq_fire(NVIC_TIM3_IRQ);
+		ssd1306_emu_render(img);
+		for (y = 0; y < EMU_HEIGHT; y++) {
+			for (x = 0; x < EMU_WIDTH; x++)
+				acc[y][x] += img[y][x];
+		}
+	}
+
+	oled_gray_get_stats(&stats);
+	oled_gray_stop();
+
+	printf("shade  brightness\n");
+	for (s = 0; s < OLED_GRAY_SHADES; s++) {
+		level = bar_level(s);
+		printf("%5u  %10.1f\n", s, level);
+		if (s && level <= prev + 8.0) {
+			printf("shade %u is not brighter than shade %u\n", s,
+			       s - 1);
+			ret = EXIT_FAILURE;
+		}
+		prev = level;
+	}
+
+	if (stats.shown != TICKS || stats.missed) {
+		printf("%u planes shown, %u missed of %u ticks\n",
+		       (unsigned int)stats.shown, (unsigned int)stats.missed,
+		       TICKS);
+		ret = EXIT_FAILURE;
+	}
+	if (ssd1306_emu_errors()) {
+		printf("emulator: %u bad commands\n",
+		       (unsigned int)ssd1306_emu_errors());
+		ret = EXIT_FAILURE;
+	}
+
+	/* Stubbed cycle counter counts nanoseconds */
+	bytes = (double)(stub_i2c_bytes - bytes0) / stats.shown;
+	printf("tick, host ns: %.0f mean, %u max (emulator included)\n",
+	       (double)stats.cycles / stats.shown,
+	       (unsigned int)stats.cycles_max);
+	printf("plane: %.0f I2C bytes, %.1f ms at 400 kHz -> %.0f planes/s max\n",
+	       bytes, bytes * I2C_BITS * 1000.0 / I2C_HZ,
+	       I2C_HZ / (bytes * I2C_BITS));
+	printf("plane: %u SPI bytes, %.2f ms at 9 MHz -> %.0f planes/s max\n",
+	       SPI_PLANE_BYTES, SPI_PLANE_BYTES * 8 * 1000.0 / SPI_HZ,
+	       SPI_HZ / (SPI_PLANE_BYTES * 8.0));
+
+	for (y = 0; y < EMU_HEIGHT; y++) {
+		for (x = 0; x < EMU_WIDTH; x++)
+			img[y][x] = acc[y][x] / TICKS;
+	}
+	snprintf(path, sizeof(path), "%s/gray.png", out_dir);
+	if (ssd1306_emu_save_png(path, img, PNG_SCALE))
+		ret = EXIT_FAILURE;
+
+	return ret;
+}
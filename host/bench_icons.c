@@ -0,0 +1,170 @@
+/**
+ * @file
+ *
+ * Icon blitter benchmark: every asset of assets/icons is drawn at page
+ * aligned, unaligned and clipped positions, RLE and raw, normal and
+ * inverted. The output is checked against the same pixels drawn one by one
+ * from the raw page layout data.
+ */
+
+#include "../inc/oled_ssd1306.h"
+#include "stubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ITERATIONS	20000
+
+/* Generated by host/Makefile */
+extern const bitmap_def_t * const icons_rle[];
+extern const char * const icons_rle_names[];
+extern const bitmap_def_t * const icons_raw[];
+
+static const struct {
+	const char *name;
+	int16_t x;
+	int16_t y;
+} spots[] = {
+	{ "aligned", 40, 16 },
+	{ "y = 3", 40, 19 },
+	{ "clipped", -5, 58 },
+};
+
+/* Encoded data length: walk RLE tokens until the bitmap is complete */
+static unsigned int data_size(const bitmap_def_t *bmp)
+{
+	unsigned int left = bmp->width * ((bmp->height + 7) / 8);
+	const uint8_t *p = bmp->data;
+	unsigned int n;
+
+	if (!(bmp->flags & BITMAP_RLE))
+		return left;
+
+	while (left) {
+		if (*p < 0x80) {
+			n = *p + 1;
+			p += 1 + n;
+		} else {
+			n = *p - 125;
+			p += 2;
+		}
+		left -= n;
+	}
+
+	return p - bmp->data;
+}
+
+/* Reference: pixel by pixel from raw page layout data */
+static void draw_ref(const bitmap_def_t *raw, int16_t x, int16_t y,
+		     oled_color_t color, const oled_rect_t *clip)
+{
+	int16_t col, row, dx, dy;
+	bool px;
+
+	for (row = 0; row < raw->height; row++) {
+		for (col = 0; col < raw->width; col++) {
+			dx = x + col;
+			dy = y + row;
+			if (dx < clip->x0 || dx > clip->x1 || dy < clip->y0 ||
+			    dy > clip->y1 || dx < 0 || dy < 0 ||
+			    dx >= SSD1306_WIDTH || dy >= SSD1306_HEIGHT)
+				continue;
+			px = (raw->data[row / 8 * raw->width + col] >>
+			      (row % 8)) & 1;
+			ssd1306_draw_pixel(dx, dy, px ? color : !color);
+		}
+	}
+}
+
+static int check(unsigned int n, int16_t x, int16_t y, oled_color_t color,
+		 const oled_rect_t *clip)
+{
+	static uint8_t ref[OLED_BUFF_LEN];
+	const oled_rect_t screen = {
+		0, 0, SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1
+	};
+
+	ssd1306_fill(color);
+	draw_ref(icons_raw[n], x, y, color, clip ? clip : &screen);
+	memcpy(ref, ssd1306_get_buffer(), sizeof(ref));
+
+	ssd1306_fill(color);
+	ssd1306_blit(icons_rle[n], x, y, color, clip);
+	if (memcmp(ref, ssd1306_get_buffer(), sizeof(ref))) {
+		printf("%s at %d, %d: RLE blit differs\n", icons_rle_names[n],
+		       x, y);
+		return -1;
+	}
+
+	ssd1306_fill(color);
+	ssd1306_blit(icons_raw[n], x, y, color, clip);
+	if (memcmp(ref, ssd1306_get_buffer(), sizeof(ref))) {
+		printf("%s at %d, %d: raw blit differs\n", icons_rle_names[n],
+		       x, y);
+		return -1;
+	}
+
+	return 0;
+}
+
+static double bench(const bitmap_def_t *bmp, int16_t x, int16_t y)
+{
+	unsigned int i;
+	double t0;
+
+	t0 = now_ns();
+	for (i = 0; i < ITERATIONS; i++)
+		ssd1306_blit(bmp, x, y, (i & 1) ? BLACK : WHITE, NULL);
+
+	return (now_ns() - t0) / ITERATIONS;
+}
+
+int main(void)
+{
+	const oled_rect_t clip = { 42, 18, 47, 25 };
+	oled_ssd1306_t obj = { 0 };
+	int ret = EXIT_SUCCESS;
+	unsigned int n, s, raw, rle, total_raw = 0, total = 0;
+	int16_t x, y;
+
+	ssd1306_init(&obj);
+
+	for (n = 0; icons_rle[n]; n++) {
+		for (y = -14; y < SSD1306_HEIGHT + 2; y += 5) {
+			for (x = -14; x < SSD1306_WIDTH + 2; x += 11) {
+				if (check(n, x, y, WHITE, NULL) ||
+				    check(n, x, y, BLACK, NULL) ||
+				    check(n, x, y, WHITE, &clip))
+					ret = EXIT_FAILURE;
+			}
+		}
+	}
+
+	/* Flash: data bytes, the descriptor takes sizeof(bitmap_def_t) more */
+	printf("%-22s %5s %5s", "icon", "raw", "RLE");
+	for (s = 0; s < ARRAY_SIZE(spots); s++)
+		printf(" %8s %8s", spots[s].name, "RLE");
+	printf("  (ns per blit)\n");
+
+	for (n = 0; icons_rle[n]; n++) {
+		raw = data_size(icons_raw[n]);
+		rle = data_size(icons_rle[n]);
+		/* make icons keeps RLE only where it is smaller */
+		total_raw += raw;
+		total += MIN(raw, rle);
+
+		printf("%-22s %5u %5u", icons_rle_names[n], raw, rle);
+		for (s = 0; s < ARRAY_SIZE(spots); s++) {
+			printf(" %8.1f", bench(icons_raw[n], spots[s].x,
+					       spots[s].y));
+			printf(" %8.1f", bench(icons_rle[n], spots[s].x,
+					       spots[s].y));
+		}
+		printf("\n");
+	}
+	printf("icon data in firmware: %u bytes, %u if all raw\n", total,
+	       total_raw);
+
+	return ret;
+}
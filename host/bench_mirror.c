@@ -0,0 +1,131 @@
+/**
+ * @file
+ *
+ * Display mirroring cost: telemetry bytes needed to bring the host picture
+ * up to date after typical screen changes. Records are decoded the same way
+ * PyQt5_gui/co2_console.py does it, and the result is checked against the
+ * presented frame.
+ */
+
+#include "../inc/oled_mirror.h"
+#include "../inc/oled_ssd1306.h"
+#include "../inc/serial.h"
+#include "../inc/telemetry.h"
+#include "../inc/ui.h"
+#include "stubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Link bytes per second at 115200 baud, 8N1 */
+#define LINK_RATE	11520
+/* New CO2 reading this often, msec */
+#define SAMPLE_PERIOD	5000
+
+static uint8_t host_picture[OLED_BUFF_LEN];
+static uint32_t wire_bytes, records;
+
+/* Telemetry stub: decode the record at once, as the host would */
+int telemetry_send(uint8_t type, const uint8_t *payload, uint16_t len)
+{
+	uint16_t pos, i = OLED_MIRROR_HDR_LEN, run;
+
+	if (type != TELEMETRY_OLED || len > TELEMETRY_PAYLOAD_MAX)
+		return -1;
+
+	/* type, seq, crc, COBS code bytes and delimiter */
+	wire_bytes += len + 4 + (len + 4) / 254 + 2;
+	records++;
+
+	if (payload[0] & OLED_MIRROR_RESET)
+		memset(host_picture, 0, sizeof(host_picture));
+	pos = payload[1] | payload[2] << 8;
+
+	while (i < len) {
+		run = (payload[i] & 0x7f) + 1;
+		if (payload[i++] & 0x80) {
+			for (; run; run--)
+				host_picture[pos++] ^= payload[i++];
+		} else {
+			pos += run;
+		}
+	}
+
+	return 0;
+}
+
+/* TX FIFO is always empty: the link keeps up */
+fifo_len_t serial_get_tx_free(uint32_t usart)
+{
+	UNUSED(usart);
+	return FIFO_SIZE;
+}
+
+/* Run UI and mirror until the host is up to date; ticks taken */
+static unsigned int sync(void)
+{
+	unsigned int ticks = 0;
+	uint32_t last;
+
+	do {
+		last = records;
+		stub_swtimer_run();
+		ticks++;
+	} while (records != last);
+
+	return ticks;
+}
+
+static int report(const char *name, unsigned int updates)
+{
+	uint32_t bytes = wire_bytes, recs = records;
+	unsigned int ticks = 0, n;
+
+	for (n = 0; n < updates; n++) {
+		ui_number_set(&bench_main.co2_value, bench_co2_sample(n));
+		ui_chart_add(&bench_main.co2_chart, bench_co2_sample(n));
+		ticks += sync();
+	}
+	bytes = wire_bytes - bytes;
+	recs = records - recs;
+
+	printf("%-16s %8.1f %8.1f %8.1f %8.2f%%\n", name,
+	       (double)bytes / updates, (double)recs / updates,
+	       (double)ticks * OLED_MIRROR_PERIOD / updates,
+	       100.0 * bytes / updates * 1000 / SAMPLE_PERIOD / LINK_RATE);
+
+	if (memcmp(host_picture, ssd1306_get_frame(), OLED_BUFF_LEN)) {
+		printf("%s: host picture differs\n", name);
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	oled_ssd1306_t obj = { 0 };
+	int ret = EXIT_SUCCESS;
+	uint32_t bytes;
+
+	ssd1306_init(&obj);
+	ui_init(UI_FPS_DEFAULT);
+	oled_mirror_init(0);
+
+	bench_main_init();
+	ui_show(&bench_main.screen);
+
+	bytes = wire_bytes;
+	sync();
+	printf("whole screen: %u bytes, raw framebuffer is %u\n",
+	       (unsigned int)(wire_bytes - bytes), OLED_BUFF_LEN);
+
+	printf("%-16s %8s %8s %8s %9s\n", "case", "bytes", "records", "msec",
+	       "link");
+	if (report("first samples", SSD1306_WIDTH) ||
+	    report("chart full", 4 * SSD1306_WIDTH))
+		ret = EXIT_FAILURE;
+
+	return ret;
+}
@@ -0,0 +1,340 @@
+/**
+ * @file
+ *
+ * Render benchmark on the SSD1306 emulator: typical screens are drawn and
+ * presented, the command/data stream goes through the emulator, and the
+ * picture it shows is checked against the framebuffer pixel by pixel.
+ * Pictures are saved as PGM and PNG to the directory given in the command
+ * line (current one by default).
+ *
+ * That check can't see a drawing bug, both sides come from the same
+ * framebuffer. So scenes also have reference pictures (golden images):
+ *
+ *   bench_render -t GOLDEN_DIR [OUT_DIR]  -- draw every scene once, compare
+ *                                            its PGM byte for byte with
+ *                                            GOLDEN_DIR/<scene>.pgm
+ *   bench_render -u GOLDEN_DIR            -- write the references
+ *
+ * Both run each scene once, without timing, so scene state is the same.
+ */
+
+#include "../inc/oled_ssd1306.h"
+#include "../inc/ui.h"
+#include "ssd1306_emu.h"
+#include "stubs.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define ITERATIONS	5000
+#define PNG_SCALE	4
+
+/* Settings menu */
+static const char * const menu_items[] = {
+	"Display", "ABC period", "Alarm level", "Calibration", "About",
+};
+static struct ui_screen menu_screen;
+static struct ui_label menu_title;
+static struct ui_menu menu;
+
+/* PGM of the whole screen, scale 1 */
+#define PGM_MAX		(32 + SSD1306_WIDTH * SSD1306_HEIGHT)
+
+static unsigned int iter;
+static const char *out_dir = ".";
+static const char *golden_dir;	/* test against references in it */
+static bool golden_update;	/* write references instead */
+
+static void screens_init(void)
+{
+	unsigned int n;
+
+	bench_main_init();
+
+	ui_label_init(&menu_title, 0, 0, SSD1306_WIDTH, &font_7x10,
+		      "Settings");
+	ui_menu_init(&menu, 0, 16, SSD1306_WIDTH, 4, &font_7x10, menu_items,
+		     ARRAY_SIZE(menu_items));
+	ui_screen_add(&menu_screen, &menu_title.base);
+	ui_screen_add(&menu_screen, &menu.base);
+
+	ui_number_set(&bench_main.co2_value, bench_co2_sample(0));
+	for (n = 0; n < SSD1306_WIDTH; n++)
+		ui_chart_add(&bench_main.co2_chart, bench_co2_sample(n));
+}
+
+/* Draw and present one frame, as the UI frame tick does */
+static void frame(void)
+{
+	stub_swtimer_run();
+}
+
+static void scene_main(void)
+{
+	ui_show(&bench_main.screen);
+	frame();
+}
+
+/* Most common update: new reading, the chart scrolls */
+static void scene_main_update(void)
+{
+	ui_number_set(&bench_main.co2_value, bench_co2_sample(iter));
+	ui_chart_add(&bench_main.co2_chart, bench_co2_sample(iter));
+	frame();
+}
+
+/* New reading alone: usually only the last digits change */
+static void scene_co2_update(void)
+{
+	ui_number_set(&bench_main.co2_value, bench_co2_sample(iter));
+	frame();
+}
+
+static void scene_menu(void)
+{
+	ui_show(&menu_screen);
+	ui_menu_select(&menu, 3);
+	frame();
+}
+
+static void scene_menu_move(void)
+{
+	ui_menu_move(&menu, 1);
+	frame();
+}
+
+static void scene_shapes(void)
+{
+	ssd1306_fill(BLACK);
+	ssd1306_draw_rectangle(0, 0, 127, 63, WHITE);
+	ssd1306_draw_circle(32, 32, 24, WHITE);
+	ssd1306_draw_arc(96, 32, 24, 45, 270, WHITE);
+	ssd1306_line(0, 63, 127, 0, WHITE);
+	ssd1306_fill_rectangle(60, 20, 68, 44, WHITE);
+	ssd1306_update_screen();
+}
+
+static const struct {
+	const char *name;
+	void (*draw)(void);
+	bool repeat;		/* benchmark it */
+} scenes[] = {
+	{ "main", scene_main, true },
+	{ "main_update", scene_main_update, true },
+	{ "co2_update", scene_co2_update, true },
+	{ "menu", scene_menu, true },
+	{ "menu_move", scene_menu_move, true },
+	{ "shapes", scene_shapes, true },
+};
+
+/* Panel must show exactly what is in the framebuffer */
+static int check_picture(const char *name, emu_image_t img)
+{
+	const uint8_t *fb = ssd1306_get_buffer();
+	unsigned int x, y;
+	bool px;
+
+	if (ssd1306_emu_errors()) {
+		printf("%s: %u bad commands\n", name, ssd1306_emu_errors());
+		return -1;
+	}
+
+	for (y = 0; y < SSD1306_HEIGHT; y++) {
+		for (x = 0; x < SSD1306_WIDTH; x++) {
+			px = (fb[y / 8 * SSD1306_WIDTH + x] >> (y % 8)) & 1;
+			if (px != !!img[y][x]) {
+				printf("%s: pixel %u, %u differs\n", name, x,
+				       y);
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void save_picture(const char *name, emu_image_t img)
+{
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s/%s.pgm", out_dir, name);
+	if (ssd1306_emu_save_pgm(path, img, 1))
+		printf("%s: can't save\n", path);
+	snprintf(path, sizeof(path), "%s/%s.png", out_dir, name);
+	if (ssd1306_emu_save_png(path, img, PNG_SCALE))
+		printf("%s: can't save\n", path);
+}
+
+static long read_file(const char *path, uint8_t *buf, size_t size)
+{
+	FILE *f = fopen(path, "rb");
+	size_t n;
+
+	if (!f)
+		return -1;
+	n = fread(buf, 1, size, f);
+	fclose(f);
+
+	return n;
+}
+
+/* Saved picture must match the reference byte for byte */
+static int check_golden(const char *name)
+{
+	static uint8_t out[PGM_MAX], ref[PGM_MAX];
+	char path[256];
+	long out_len, ref_len, i;
+
+	snprintf(path, sizeof(path), "%s/%s.pgm", out_dir, name);
+	out_len = read_file(path, out, sizeof(out));
+	snprintf(path, sizeof(path), "%s/%s.pgm", golden_dir, name);
+	ref_len = read_file(path, ref, sizeof(ref));
+	if (ref_len < 0) {
+		printf("%s: no reference %s\n", name, path);
+		return -1;
+	}
+
+	if (out_len != ref_len) {
+		printf("%s: %ld bytes, reference has %ld\n", name, out_len,
+		       ref_len);
+		return -1;
+	}
+	for (i = 0; i < out_len; i++) {
+		if (out[i] != ref[i]) {
+			printf("%s: differs from %s at byte %ld\n", name, path,
+			       i);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/* Draw every scene once and check it against its reference (or write it) */
+static int test_golden(void)
+{
+	static emu_image_t img;
+	int ret = EXIT_SUCCESS;
+	char path[256];
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(scenes); i++) {
+		scenes[i].draw();
+		ssd1306_emu_render(img);
+		if (check_picture(scenes[i].name, img))
+			ret = EXIT_FAILURE;
+
+		if (golden_update) {
+			snprintf(path, sizeof(path), "%s/%s.pgm", golden_dir,
+				 scenes[i].name);
+			if (ssd1306_emu_save_pgm(path, img, 1)) {
+				printf("%s: can't save\n", path);
+				ret = EXIT_FAILURE;
+			}
+			continue;
+		}
+
+		save_picture(scenes[i].name, img);
+		if (check_golden(scenes[i].name))
+			ret = EXIT_FAILURE;
+		else
+			printf("%-12s ok\n", scenes[i].name);
+	}
+
+	return ret;
+}
+
+/* Continuous scroll: after 2 frames (interval code 7) picture moves right */
+static int check_scroll(void)
+{
+	static emu_image_t before, after;
+	unsigned int x, y;
+
+	scene_shapes();
+	ssd1306_emu_render(before);
+	ssd1306_scroll_start(0, EMU_PAGES - 1, SSD1306_SCROLL_RIGHT, 7, 0);
+	ssd1306_emu_frames(2 * 3);
+	ssd1306_emu_render(after);
+	ssd1306_scroll_stop();
+	ssd1306_update_screen();
+
+	for (y = 0; y < SSD1306_HEIGHT; y++) {
+		for (x = 0; x < SSD1306_WIDTH; x++) {
+			if (after[y][(x + 3) % SSD1306_WIDTH] != before[y][x]) {
+				printf("scroll: pixel %u, %u differs\n", x, y);
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	static emu_image_t img;
+	oled_ssd1306_t obj = { 0 };
+	int ret = EXIT_SUCCESS;
+	uint32_t bytes;
+	unsigned int i;
+	double t0, t1;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "t:u:")) != -1) {
+		switch (opt) {
+		case 'u':
+			golden_update = true;
+			/* fall through */
+		case 't':
+			golden_dir = optarg;
+			break;
+		default:
+			printf("usage: %s [-t|-u GOLDEN_DIR] [OUT_DIR]\n",
+			       argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (optind < argc)
+		out_dir = argv[optind];
+
+	ssd1306_init(&obj);
+	ui_init(UI_FPS_DEFAULT);
+	screens_init();
+
+	if (golden_dir)
+		return test_golden();
+
+	printf("%-12s %14s %14s %10s\n", "scene", "ns per frame",
+	       "ns per picture", "bus bytes");
+	for (i = 0; i < ARRAY_SIZE(scenes); i++) {
+		bytes = stub_i2c_bytes;
+		scenes[i].draw();
+		bytes = stub_i2c_bytes - bytes;
+
+		ssd1306_emu_render(img);
+		if (check_picture(scenes[i].name, img))
+			ret = EXIT_FAILURE;
+		save_picture(scenes[i].name, img);
+
+		t0 = now_ns();
+		for (iter = 0; iter < ITERATIONS; iter++)
+			scenes[i].draw();
+		t1 = now_ns();
+		for (iter = 0; iter < ITERATIONS; iter++)
+			ssd1306_emu_render(img);
+
+		printf("%-12s %14.1f %14.1f %10u\n", scenes[i].name,
+		       (t1 - t0) / ITERATIONS, (now_ns() - t1) / ITERATIONS,
+		       (unsigned int)bytes);
+
+		if (check_picture(scenes[i].name, img))
+			ret = EXIT_FAILURE;
+	}
+
+	if (check_scroll())
+		ret = EXIT_FAILURE;
+
+	return ret;
+}
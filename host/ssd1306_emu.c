@@ -0,0 +1,516 @@
+/**
+ * @file
+ *
+ * SSD1306 controller emulator: interprets the command and data stream the
+ * driver sends over I2C into display RAM, and turns display RAM into the
+ * picture the panel would show.
+ *
+ * Supported: horizontal, vertical and page addressing modes with column and
+ * page windows, display start line and offset, segment/COM remap, inverse
+ * and entire display on, contrast, multiplex ratio, continuous horizontal
+ * and vertical scroll (advanced by ssd1306_emu_frames()) and one column
+ * content scroll (0x2C/0x2D). Timing and charge pump are accepted and
+ * ignored.
+ *
+ * Picture orientation follows the driver: with its default init (segment
+ * remap 0xA1, COM scan 0xC8) image x, y are framebuffer x, y; 0xA0/0xC0
+ * mirror the picture, as SSD1306_MIRROR_HORIZ/VERT do on the module.
+ */
+
+#include "ssd1306_emu.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Control byte bits */
+#define CTRL_CO		0x80	/* one byte follows, then control byte again */
+#define CTRL_DC		0x40	/* data, not command */
+
+/* Longest command with its arguments: 0x26/0x27/0x2C/0x2D */
+#define CMD_MAX		7
+
+/* Continuous scroll step period, frames, by interval code */
+static const uint16_t emu_scroll_frames[8] = {
+	5, 64, 128, 256, 3, 4, 25, 2
+};
+
+static struct {
+	uint8_t ram[EMU_PAGES][EMU_WIDTH];
+
+	/* Command being collected */
+	uint8_t cmd[CMD_MAX];
+	uint8_t cmd_len;
+
+	/* Addressing */
+	uint8_t mode;		/* 0 - horizontal, 1 - vertical, 2 - page */
+	uint8_t col, page;	/* RAM pointer */
+	uint8_t col0, col1;	/* column window */
+	uint8_t page0, page1;	/* page window */
+	uint8_t page_col;	/* column start in page mode */
+
+	/* Picture */
+	bool on;
+	bool entire_on;
+	bool inverse;
+	bool seg_remap;
+	bool com_remap;
+	uint8_t contrast;
+	uint8_t start_line;
+	uint8_t offset;
+	uint8_t mux;		/* rows - 1 */
+
+	/* Continuous scroll */
+	bool scroll;
+	uint8_t scroll_cmd;
+	uint8_t scroll_p0, scroll_p1;
+	uint8_t scroll_interval;
+	uint8_t scroll_voffset;
+	uint16_t scroll_frames;	/* frames since the last step */
+	uint8_t vfixed;		/* vertical scroll area: fixed rows on top */
+	uint8_t vrows;		/* rows in the area */
+	uint8_t vscroll;	/* current vertical scroll, rows */
+
+	uint32_t errors;	/* unknown or malformed commands */
+} emu;
+
+/* Power-on state, datasheet 8.9 */
+void ssd1306_emu_reset(void)
+{
+	memset(&emu, 0, sizeof(emu));
+	emu.mode = 2;
+	emu.col1 = EMU_WIDTH - 1;
+	emu.page1 = EMU_PAGES - 1;
+	emu.contrast = 0x7f;
+	emu.mux = EMU_HEIGHT - 1;
+	emu.vrows = EMU_HEIGHT;
+}
+
+/* Arguments after the command byte */
+static int emu_cmd_args(uint8_t c)
+{
+	switch (c) {
+	case 0x20: case 0x81: case 0x8d: case 0xa8: case 0xd3:
+	case 0xd5: case 0xd9: case 0xda: case 0xdb:
+		return 1;
+	case 0x21: case 0x22: case 0xa3:
+		return 2;
+	case 0x29: case 0x2a:
+		return 5;
+	case 0x26: case 0x27: case 0x2c: case 0x2d:
+		return 6;
+	default:
+		return 0;
+	}
+}
+
+/* Move columns x0..x1 of the page by one column, wrapping around */
+static void emu_rotate(uint8_t page, uint8_t x0, uint8_t x1, bool right)
+{
+	uint8_t *p = &emu.ram[page][x0];
+	uint8_t t;
+
+	if (x0 >= x1)
+		return;
+
+	if (right) {
+		t = p[x1 - x0];
+		memmove(p + 1, p, x1 - x0);
+		p[0] = t;
+	} else {
+		t = p[0];
+		memmove(p, p + 1, x1 - x0);
+		p[x1 - x0] = t;
+	}
+}
+
+static void emu_scroll_step(void)
+{
+	bool right = emu.scroll_cmd == 0x26 || emu.scroll_cmd == 0x29;
+	uint8_t page;
+
+	for (page = emu.scroll_p0; page <= emu.scroll_p1; page++)
+		emu_rotate(page, 0, EMU_WIDTH - 1, right);
+
+	if (emu.scroll_voffset && emu.vrows)
+		emu.vscroll = (emu.vscroll + emu.scroll_voffset) % emu.vrows;
+}
+
+static void emu_exec(const uint8_t *c)
+{
+	uint8_t page;
+
+	if (c[0] <= 0x0f) {
+		emu.page_col = (emu.page_col & 0xf0) | c[0];
+		emu.col = emu.page_col;
+	} else if (c[0] <= 0x1f) {
+		emu.page_col = (emu.page_col & 0x0f) | (c[0] & 0x0f) << 4;
+		emu.col = emu.page_col;
+	} else if (c[0] >= 0x40 && c[0] <= 0x7f) {
+		emu.start_line = c[0] & 0x3f;
+	} else if (c[0] >= 0xb0 && c[0] <= 0xb7) {
+		emu.page = c[0] & 0x07;
+	} else {
+		switch (c[0]) {
+		case 0x20:
+			if ((c[1] & 0x03) == 3)
+				emu.errors++;
+			else
+				emu.mode = c[1] & 0x03;
+			break;
+		case 0x21:
+			emu.col0 = emu.col = c[1] & 0x7f;
+			emu.col1 = c[2] & 0x7f;
+			break;
+		case 0x22:
+			emu.page0 = emu.page = c[1] & 0x07;
+			emu.page1 = c[2] & 0x07;
+			break;
+		case 0x26: case 0x27:
+		case 0x29: case 0x2a:
+			emu.scroll_cmd = c[0];
+			emu.scroll_p0 = c[2] & 0x07;
+			emu.scroll_interval = c[3] & 0x07;
+			emu.scroll_p1 = c[4] & 0x07;
+			emu.scroll_voffset = (c[0] >= 0x29) ? c[5] & 0x3f : 0;
+			break;
+		case 0x2c: case 0x2d:
+			if (emu.scroll) {
+				emu.errors++;
+				break;
+			}
+			for (page = c[2] & 0x07; page <= (c[4] & 0x07); page++)
+				emu_rotate(page, c[5] & 0x7f, c[6] & 0x7f,
+					   c[0] == 0x2c);
+			break;
+		case 0x2e:
+			emu.scroll = false;
+			break;
+		case 0x2f:
+			emu.scroll = emu.scroll_cmd != 0;
+			emu.scroll_frames = 0;
+			break;
+		case 0x81:
+			emu.contrast = c[1];
+			break;
+		case 0xa0: case 0xa1:
+			emu.seg_remap = c[0] & 1;
+			break;
+		case 0xa3:
+			emu.vfixed = c[1] & 0x3f;
+			emu.vrows = c[2] & 0x7f;
+			break;
+		case 0xa4: case 0xa5:
+			emu.entire_on = c[0] & 1;
+			break;
+		case 0xa6: case 0xa7:
+			emu.inverse = c[0] & 1;
+			break;
+		case 0xa8:
+			if ((c[1] & 0x3f) < 15)
+				emu.errors++;
+			else
+				emu.mux = c[1] & 0x3f;
+			break;
+		case 0xae: case 0xaf:
+			emu.on = c[0] & 1;
+			break;
+		case 0xc0: case 0xc8:
+			emu.com_remap = c[0] & 0x08;
+			break;
+		case 0xd3:
+			emu.offset = c[1] & 0x3f;
+			break;
+		case 0x8d: case 0xd5: case 0xd9: case 0xda: case 0xdb:
+		case 0xe3:
+			break;
+		default:
+			emu.errors++;
+			break;
+		}
+	}
+}
+
+static void emu_cmd_byte(uint8_t b)
+{
+	emu.cmd[emu.cmd_len++] = b;
+	if (emu.cmd_len > emu_cmd_args(emu.cmd[0])) {
+		emu_exec(emu.cmd);
+		emu.cmd_len = 0;
+	}
+}
+
+/* Store byte at the RAM pointer and advance it, datasheet 10.1.3 */
+static void emu_data_byte(uint8_t b)
+{
+	emu.ram[emu.page][emu.col] = b;
+
+	switch (emu.mode) {
+	case 0:
+		if (emu.col++ < emu.col1)
+			break;
+		emu.col = emu.col0;
+		if (emu.page++ >= emu.page1)
+			emu.page = emu.page0;
+		break;
+	case 1:
+		if (emu.page++ < emu.page1)
+			break;
+		emu.page = emu.page0;
+		if (emu.col++ >= emu.col1)
+			emu.col = emu.col0;
+		break;
+	default:
+		if (emu.col++ >= EMU_WIDTH - 1)
+			emu.col = emu.page_col;
+		break;
+	}
+}
+
+/**
+ * Feed one I2C write transfer addressed to the controller.
+ *
+ * @param ctrl Control byte (Co, D/C#)
+ * @param buf Bytes after the control byte
+ * @param len Number of bytes
+ */
+void ssd1306_emu_write(uint8_t ctrl, const uint8_t *buf, uint16_t len)
+{
+	uint16_t i;
+
+	for (i = 0; i < len; i++) {
+		if (ctrl & CTRL_DC)
+			emu_data_byte(buf[i]);
+		else
+			emu_cmd_byte(buf[i]);
+
+		/* Co = 1: one byte only, then the next control byte */
+		if ((ctrl & CTRL_CO) && ++i < len)
+			ctrl = buf[i];
+	}
+}
+
+/* Let the controller run for some frames: continuous scroll moves */
+void ssd1306_emu_frames(unsigned int frames)
+{
+	uint16_t period = emu_scroll_frames[emu.scroll_interval];
+
+	if (!emu.scroll)
+		return;
+
+	for (emu.scroll_frames += frames; emu.scroll_frames >= period;
+	     emu.scroll_frames -= period)
+		emu_scroll_step();
+}
+
+/* Display RAM, in framebuffer layout */
+const uint8_t *ssd1306_emu_ram(void)
+{
+	return &emu.ram[0][0];
+}
+
+/* Commands the emulator did not understand */
+uint32_t ssd1306_emu_errors(void)
+{
+	return emu.errors;
+}
+
+/* RAM row shown on display row r (before COM remap) */
+static uint8_t emu_ram_row(uint8_t r)
+{
+	uint8_t row = (r + emu.offset) % EMU_HEIGHT;
+
+	if (emu.vscroll && row >= emu.vfixed && row < emu.vfixed + emu.vrows)
+		row = emu.vfixed + (row - emu.vfixed + emu.vscroll) % emu.vrows;
+
+	return (row + emu.start_line) % EMU_HEIGHT;
+}
+
+/**
+ * Render what the panel shows.
+ *
+ * Lit pixels get brightness by contrast, 64 .. 255.
+ *
+ * @param[out] img Picture
+ */
+void ssd1306_emu_render(emu_image_t img)
+{
+	const uint8_t lit = 64 + emu.contrast * 191 / 255;
+	uint8_t x, y, r, c, row;
+	bool px;
+
+	for (y = 0; y < EMU_HEIGHT; y++) {
+		r = emu.com_remap ? y : EMU_HEIGHT - 1 - y;
+		row = emu_ram_row(r);
+		for (x = 0; x < EMU_WIDTH; x++) {
+			c = emu.seg_remap ? x : EMU_WIDTH - 1 - x;
+			px = (emu.ram[row / 8][c] >> (row % 8)) & 1;
+			px = (px || emu.entire_on) ^ emu.inverse;
+			if (!emu.on || r > emu.mux)
+				px = false;
+			img[y][x] = px ? lit : 0;
+		}
+	}
+}
+
+/**
+ * Save picture as binary PGM.
+ *
+ * @param path File name
+ * @param img Picture
+ * @param scale Pixel size in the file
+ * @return 0 on success or negative value on error
+ */
+int ssd1306_emu_save_pgm(const char *path, const emu_image_t img,
+			 unsigned int scale)
+{
+	unsigned int x, y, s;
+	FILE *f;
+	int ret = 0;
+
+	f = fopen(path, "wb");
+	if (!f)
+		return -errno;
+
+	fprintf(f, "P5\n%u %u\n255\n", EMU_WIDTH * scale, EMU_HEIGHT * scale);
+	for (y = 0; y < EMU_HEIGHT * scale; y++) {
+		for (x = 0; x < EMU_WIDTH; x++) {
+			for (s = 0; s < scale; s++)
+				fputc(img[y / scale][x], f);
+		}
+	}
+
+	if (ferror(f))
+		ret = -EIO;
+	if (fclose(f))
+		ret = -EIO;
+
+	return ret;
+}
+
+static uint32_t png_crc_table[256];
+
+static uint32_t png_crc(uint32_t crc, const uint8_t *buf, size_t len)
+{
+	uint32_t c;
+	size_t i;
+	int k;
+
+	if (!png_crc_table[1]) {
+		for (i = 0; i < 256; i++) {
+			c = i;
+			for (k = 0; k < 8; k++)
+				c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+			png_crc_table[i] = c;
+		}
+	}
+
+	crc = ~crc;
+	for (i = 0; i < len; i++)
+		crc = png_crc_table[(crc ^ buf[i]) & 0xff] ^ (crc >> 8);
+
+	return ~crc;
+}
+
+static void png_put32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data,
+		      uint32_t len)
+{
+	uint8_t hdr[8], crc[4];
+
+	png_put32(hdr, len);
+	memcpy(hdr + 4, type, 4);
+	png_put32(crc, png_crc(png_crc(0, hdr + 4, 4), data, len));
+
+	fwrite(hdr, 1, sizeof(hdr), f);
+	fwrite(data, 1, len, f);
+	fwrite(crc, 1, sizeof(crc), f);
+}
+
+/**
+ * Save picture as 8-bit grayscale PNG. The image data goes in stored
+ * (uncompressed) deflate blocks, so no zlib is needed.
+ *
+ * @param path File name
+ * @param img Picture
+ * @param scale Pixel size in the file, up to 8
+ * @return 0 on success or negative value on error
+ */
+int ssd1306_emu_save_png(const char *path, const emu_image_t img,
+			 unsigned int scale)
+{
+	static const uint8_t sig[8] = {
+		0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+	};
+	/* Rows with filter byte, zlib header, block headers and Adler-32 */
+	static uint8_t idat[(EMU_WIDTH * 8 + 1) * EMU_HEIGHT * 8 + 2 + 5 * 16 +
+			    4];
+	const unsigned int w = EMU_WIDTH * scale, h = EMU_HEIGHT * scale;
+	const size_t raw_len = (size_t)(w + 1) * h;
+	uint8_t ihdr[13] = { 0 };
+	uint32_t a = 1, b = 0;
+	size_t n = 0, done, blk, i;
+	uint8_t *raw;
+	unsigned int x, y;
+	FILE *f;
+	int ret = 0;
+
+	if (!scale || scale > 8)
+		return -EINVAL;
+
+	png_put32(ihdr, w);
+	png_put32(ihdr + 4, h);
+	ihdr[8] = 8;		/* bit depth */
+	ihdr[9] = 0;		/* grayscale */
+
+	/* Scanlines go right where the stored blocks need them */
+	idat[n++] = 0x78;
+	idat[n++] = 0x01;
+	for (done = 0; done < raw_len; done += blk) {
+		blk = raw_len - done;
+		if (blk > 0xffff)
+			blk = 0xffff;
+		idat[n++] = (done + blk == raw_len);	/* BFINAL, stored */
+		idat[n++] = blk & 0xff;
+		idat[n++] = blk >> 8;
+		idat[n++] = ~blk & 0xff;
+		idat[n++] = (~blk >> 8) & 0xff;
+		raw = &idat[n];
+		for (i = 0; i < blk; i++) {
+			size_t pos = done + i;
+
+			y = pos / (w + 1);
+			x = pos % (w + 1);
+			raw[i] = x ? img[y / scale][(x - 1) / scale] : 0;
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		n += blk;
+	}
+	png_put32(&idat[n], b << 16 | a);
+	n += 4;
+
+	f = fopen(path, "wb");
+	if (!f)
+		return -errno;
+
+	fwrite(sig, 1, sizeof(sig), f);
+	png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+	png_chunk(f, "IDAT", idat, n);
+	png_chunk(f, "IEND", NULL, 0);
+
+	if (ferror(f))
+		ret = -EIO;
+	if (fclose(f))
+		ret = -EIO;
+
+	return ret;
+}
@@ -0,0 +1,24 @@
+#ifndef HOST_SSD1306_EMU_H
+#define HOST_SSD1306_EMU_H
+
+#include <stdint.h>
+
+#define EMU_WIDTH	128
+#define EMU_HEIGHT	64
+#define EMU_PAGES	(EMU_HEIGHT / 8)
+
+/* What the panel shows: one byte per pixel, 0 (off) .. 255 */
+typedef uint8_t emu_image_t[EMU_HEIGHT][EMU_WIDTH];
+
+void ssd1306_emu_reset(void);
+void ssd1306_emu_write(uint8_t ctrl, const uint8_t *buf, uint16_t len);
+void ssd1306_emu_frames(unsigned int frames);
+const uint8_t *ssd1306_emu_ram(void);
+uint32_t ssd1306_emu_errors(void);
+void ssd1306_emu_render(emu_image_t img);
+int ssd1306_emu_save_pgm(const char *path, const emu_image_t img,
+			 unsigned int scale);
+int ssd1306_emu_save_png(const char *path, const emu_image_t img,
+			 unsigned int scale);
+
+#endif /* HOST_SSD1306_EMU_H */
@@ -0,0 +1,304 @@
+/**
+ * @file
+ *
+ * Host replacements for the board services used by the display code.
+ *
+ * I2C transactions complete at once, as if the bus was infinitely fast, so
+ * benchmarks measure rendering only. Writes to the display go to the
+ * SSD1306 emulator, see ssd1306_emu.c.
+ *
+ * Also the helpers shared by the benchmarks: clock and main screen setup.
+ */
+
+#include "../inc/i2c.h"
+#include "../inc/i2c_queue.h"
+#include "../inc/irq.h"
+#include "../inc/oled_ssd1306.h"
+#include "../inc/swtimer.h"
+#include "../inc/systick.h"
+#include "ssd1306_emu.h"
+#include "stubs.h"
+
+#include <libopencm3/cm3/dwt.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/timer.h>
+
+#include <stdio.h>
+#include <time.h>
+
+/* Display init starts here: power the controller on */
+int i2c_init(uint32_t base)
+{
+	UNUSED(base);
+	ssd1306_emu_reset();
+	return 0;
+}
+
+int i2c_detect_device(uint8_t addr)
+{
+	UNUSED(addr);
+	return 0;
+}
+
+/* Bytes that would go over the bus: address, control byte, payload */
+uint32_t stub_i2c_bytes;
+
+int i2c_queue_submit(struct i2c_txn *txn)
+{
+	stub_i2c_bytes += 1 + !!(txn->flags & I2C_XFER_REG) + txn->tx_len +
+			  txn->rx_len;
+	if (txn->addr == SSD1306_I2C_ADDR && (txn->flags & I2C_XFER_REG))
+		ssd1306_emu_write(txn->reg, txn->tx_buf, txn->tx_len);
+
+	txn->status = 0;
+	txn->done = txn->tx_len;
+	if (txn->cb)
+		txn->cb(txn, txn->cb_data);
+
+	return 0;
+}
+
+int i2c_queue_wait(struct i2c_txn *txn, uint32_t timeout)
+{
+	UNUSED(timeout);
+	return txn->status;
+}
+
+uint32_t systick_get_time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000UL + ts.tv_nsec / 1000;
+}
+
+uint32_t systick_get_time_ms(void)
+{
+	return systick_get_time_us() / 1000;
+}
+
+uint32_t systick_calc_diff_ms(uint32_t t1, uint32_t t2)
+{
+	return t2 - t1;
+}
+
+/* Registered timers; they fire only when stub_swtimer_run() is called */
+static struct {
+	swtimer_callback_t cb;
+	void *data;
+} stub_timers[8];
+
+int swtimer_tim_register(swtimer_callback_t cb, void *data, int period)
+{
+	unsigned int i;
+
+	UNUSED(period);
+
+	for (i = 0; i < ARRAY_SIZE(stub_timers); i++) {
+		if (!stub_timers[i].cb) {
+			stub_timers[i].cb = cb;
+			stub_timers[i].data = data;
+			return i + 1;
+		}
+	}
+
+	return -1;
+}
+
+/* Fire every registered timer once, as if its period has passed */
+void stub_swtimer_run(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(stub_timers); i++) {
+		if (stub_timers[i].cb)
+			stub_timers[i].cb(stub_timers[i].data);
+	}
+}
+
+/* Requested IRQs; they fire only when stub_irq_fire() is called */
+static struct irq_action *stub_irqs[8];
+
+int irq_request(struct irq_action *action)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(stub_irqs); i++) {
+		if (!stub_irqs[i]) {
+			stub_irqs[i] = action;
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+int irq_free(struct irq_action *action)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(stub_irqs); i++) {
+		if (stub_irqs[i] == action)
+			stub_irqs[i] = NULL;
+	}
+
+	return 0;
+}
+
+/* Call handlers of the IRQ, as if it has fired */
+void stub_irq_fire(unsigned int irq)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(stub_irqs); i++) {
+		if (stub_irqs[i] && stub_irqs[i]->irq == irq)
+			stub_irqs[i]->handler(irq, stub_irqs[i]->data);
+	}
+}
+
+/* Hardware timers do nothing; update flag is always up */
+void rcc_periph_reset_pulse(enum rcc_periph_rst rst)
+{
+	UNUSED(rst);
+}
+
+void nvic_enable_irq(uint8_t irqn)
+{
+	UNUSED(irqn);
+}
+
+void nvic_disable_irq(uint8_t irqn)
+{
+	UNUSED(irqn);
+}
+
+void nvic_set_priority(uint8_t irqn, uint8_t priority)
+{
+	UNUSED(irqn);
+	UNUSED(priority);
+}
+
+void timer_set_mode(uint32_t timer_peripheral, uint32_t clock_div,
+		    uint32_t alignment, uint32_t direction)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(clock_div);
+	UNUSED(alignment);
+	UNUSED(direction);
+}
+
+void timer_set_prescaler(uint32_t timer_peripheral, uint32_t value)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(value);
+}
+
+void timer_set_period(uint32_t timer_peripheral, uint32_t period)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(period);
+}
+
+void timer_enable_irq(uint32_t timer_peripheral, uint32_t irq)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(irq);
+}
+
+bool timer_get_flag(uint32_t timer_peripheral, uint32_t flag)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(flag);
+	return true;
+}
+
+void timer_clear_flag(uint32_t timer_peripheral, uint32_t flag)
+{
+	UNUSED(timer_peripheral);
+	UNUSED(flag);
+}
+
+void timer_disable_preload(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+void timer_continuous_mode(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+void timer_enable_update_event(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+void timer_update_on_overflow(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+void timer_enable_counter(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+void timer_disable_counter(uint32_t timer_peripheral)
+{
+	UNUSED(timer_peripheral);
+}
+
+/* Cycle counter runs at 1 GHz: "cycles" are nanoseconds */
+bool dwt_enable_cycle_counter(void)
+{
+	return true;
+}
+
+uint32_t dwt_read_cycle_counter(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000UL + ts.tv_nsec;
+}
+
+/* Monotonic time for benchmarks, nanoseconds */
+double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+struct bench_main_screen bench_main;
+
+/* CO2 reading n of a made-up but repeatable series */
+uint16_t bench_co2_sample(unsigned int n)
+{
+	return 800 + (n / 64) % 5 * 40 + (n * 7919 % 23);
+}
+
+/* Set up the main screen widgets; the screen is not shown */
+void bench_main_init(void)
+{
+	struct bench_main_screen *m = &bench_main;
+
+	ui_label_init(&m->co2_label, 0, 0, 0, &font_16x26, "CO2:");
+	ui_number_init(&m->co2_value, 64, 0, 4, &font_16x26);
+	ui_label_init(&m->status_label, 0, 27, 0, &font_7x10, "Status:");
+	ui_label_init(&m->status_value, 50, 27, 0, &font_7x10, " Ok");
+	ui_chart_init(&m->co2_chart, 0, 40, SSD1306_WIDTH, 24, 100);
+	ui_screen_add(&m->screen, &m->co2_label.base);
+	ui_screen_add(&m->screen, &m->co2_value.base);
+	ui_screen_add(&m->screen, &m->status_label.base);
+	ui_screen_add(&m->screen, &m->status_value.base);
+	ui_screen_add(&m->screen, &m->co2_chart.base);
+}
+
+/* libprintf output */
+void _putchar(char character)
+{
+	putchar(character);
+}
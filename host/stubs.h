@@ -0,0 +1,27 @@
+#ifndef HOST_STUBS_H
+#define HOST_STUBS_H
+
+#include "../inc/ui.h"
+#include <stdint.h>
+
+/* Main screen widgets, same layout as in tester.c */
+struct bench_main_screen {
+	struct ui_screen screen;
+	struct ui_label co2_label;
+	struct ui_number co2_value;
+	struct ui_label status_label;
+	struct ui_label status_value;
+	struct ui_chart co2_chart;
+};
+
+/* Bytes sent through the stubbed I2C queue so far */
+extern uint32_t stub_i2c_bytes;
+extern struct bench_main_screen bench_main;
+
+void stub_swtimer_run(void);
+void stub_irq_fire(unsigned int irq);
+double now_ns(void);
+uint16_t bench_co2_sample(unsigned int n);
+void bench_main_init(void);
+
+#endif /* HOST_STUBS_H */
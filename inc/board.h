@@ -3,10 +3,12 @@
 
 
 #include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/dma.h>
 #include <libopencm3/stm32/exti.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/i2c.h>
 #include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/spi.h>
 #include <libopencm3/stm32/timer.h>
 #include <libopencm3/stm32/usart.h>
 
@@ -24,6 +26,21 @@
 #define SERIAL_USART		USART1
 #define SERIAL_USART_RCC	RCC_USART1
 #define SERIAL_GPIO_RCC		RCC_GPIOA
+/* RS-485 transceiver driver enable (DE and /RE tied together) */
+#define RS485_DE_PORT		GPIOA
+#define RS485_DE_PIN		GPIO8
+
+/* Host link: Modbus RTU slave for PLC/SCADA, RS-485 */
+#define HOST_GPIO_PORT		GPIOA
+#define HOST_GPIO_TX_PIN	GPIO_USART2_TX
+#define HOST_GPIO_RX_PIN	GPIO_USART2_RX
+#define HOST_USART		USART2
+#define HOST_USART_RCC		RCC_USART2
+#define HOST_GPIO_RCC		RCC_GPIOA
+#define HOST_DE_PORT		GPIOA
+#define HOST_DE_PIN		GPIO1
+#define HOST_BAUD		115200
+#define HOST_MODBUS_ADDR	1
 
 
 /* I2C for OLED display */
@@ -35,6 +52,26 @@
 #define I2C_SDA_PIN			GPIO_I2C1_RE_SDA
 #define I2C_GPIO_RCC		RCC_GPIOB
 #define I2C_RCC 			RCC_I2C1
+/* I2C1 TX goes by DMA1 channel 6 */
+#define I2C_DMA_RCC			RCC_DMA1
+
+/* SPI for OLED display: SPI variant of the module (make OLED_SPI=1) */
+#define OLED_SPI		SPI1
+#define OLED_SPI_RCC		RCC_SPI1
+#define OLED_SPI_GPIO_PORT	GPIOA
+#define OLED_SPI_SCK_PIN	GPIO_SPI1_SCK
+#define OLED_SPI_MOSI_PIN	GPIO_SPI1_MOSI
+#define OLED_CS_PORT		GPIOA
+#define OLED_CS_PIN		GPIO4
+#define OLED_DC_PORT		GPIOB
+#define OLED_DC_PIN		GPIO0
+#define OLED_RST_PORT		GPIOB
+#define OLED_RST_PIN		GPIO1
+/* SPI1 TX goes by DMA1 channel 3 */
+#define OLED_SPI_DMA_CH		DMA_CHANNEL3
+#define OLED_SPI_DMA_IRQ	NVIC_DMA1_CHANNEL3_IRQ
+/* 72 MHz / 8 = 9 MHz; most modules work at / 4 = 18 MHz as well */
+#define OLED_SPI_BR		SPI_CR1_BAUDRATE_FPCLK_DIV_8
 
 /* LED on board */
 #define LED_RCC             RCC_GPIOC
@@ -53,6 +90,21 @@
 #define DS18B20_GPIO_PORT	GPIOB
 #define DS18B20_GPIO_PIN	GPIO10
 
+/*
+ * 1-Wire through USART3 (make OW_UART=1): half-duplex on its TX pin, the
+ * DS18B20 pin above, open-drain with the usual 4.7k pull-up.
+ */
+#define OW_USART		USART3
+#define OW_USART_RCC		RCC_USART3
+#define OW_DMA_TX_CH		DMA_CHANNEL2
+#define OW_DMA_RX_CH		DMA_CHANNEL3
+#define OW_DMA_RX_IRQ		NVIC_DMA1_CHANNEL3_IRQ
+
+/* USART3_RX and SPI1_TX requests are both wired to DMA1 channel 3 */
+#if USE_OW_UART && USE_OLED_SPI
+#error "OW_UART=1 and OLED_SPI=1 can't be used together: DMA1 channel 3"
+#endif
+
 /* General purpose timer */
 #define SWTIMER_TIM_RCC		RCC_TIM2
 #define SWTIMER_TIM_BASE	TIM2
@@ -61,6 +113,15 @@
 #define SWTIMER_TIM_ARR_VAL	5000-1 // 19999
 #define SWTIMER_TIM_PSC_VAL	36-1    //5
 
+/* Pseudo-grayscale plane timer (see src/oled_gray.c), 1 MHz count */
+#define OLED_GRAY_HZ		150	/* planes per second */
+#define OLED_GRAY_TIM_RCC	RCC_TIM3
+#define OLED_GRAY_TIM_BASE	TIM3
+#define OLED_GRAY_TIM_IRQ	NVIC_TIM3_IRQ
+#define OLED_GRAY_TIM_RST	RST_TIM3
+#define OLED_GRAY_TIM_ARR_VAL	(1000000 / OLED_GRAY_HZ - 1)
+#define OLED_GRAY_TIM_PSC_VAL	(72 - 1)
+
 
 int board_init(void);
 
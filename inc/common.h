@@ -7,6 +7,8 @@
 #define BIT(n)			(1 << (n))
 #define ARRAY_SIZE(a)	(sizeof(a) / sizeof(a[0]))
 #define UNUSED(x)		((void)x)
+#define MIN(a, b)		(((a) < (b)) ? (a) : (b))
+#define MAX(a, b)		(((a) > (b)) ? (a) : (b))
 
 
 void inplace_reverse(char *str);
@@ -32,6 +34,7 @@ void inplace_reverse(char *str);
  * @param[out] flags Will contain IRQ flags value before disabling interrupts;
  *                   must have "unsigned long" type
  */
+#if defined(__arm__)
 #define enter_critical(flags)						        \
 do {									                    \
 	__asm__ __volatile__ (						            \
@@ -65,6 +68,11 @@ do {									                    \
 		: "r" (flags)						                \
 		: "memory");						                \
 } while (0)
+#else
+/* Host builds (see host/): single-threaded, nothing to guard */
+#define enter_critical(flags)	do { (flags) = 0; } while (0)
+#define exit_critical(flags)	UNUSED(flags)
+#endif /* __arm__ */
 
 /**
  * Wait for some event (condition) to happen, breaking off on timeout.
@@ -119,11 +127,15 @@ static inline __attribute__((always_inline)) void ldelay(unsigned long cycles)
 
 	cm3_assert(cycles >= CYCLES_PER_LOOP);
 
+#if defined(__arm__)
 	__asm__ __volatile__
 			("1:\n" "subs %0, %1, #1\n"
 			"bne 1b"
 			: "=r" (loops)
 			: "0" (loops));
+#else
+	UNUSED(loops);
+#endif
 }
 
 /* The "volatile" is due to gcc bugs */
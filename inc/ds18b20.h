@@ -2,6 +2,7 @@
 #define DS18B20_H
 
 #include <one_wire.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 /* Contains parsed data from DS18B20 temperature sensor */
@@ -11,38 +12,36 @@ struct ds18b20_temp {
 	char sign;		/* '-' or '+' */
 };
 
+/* Conversion state */
+typedef enum {
+	DS18_SLEEP,		/* idle, last result (if any) is good */
+	DS18_CONVERTIN,		/* conversion running, polled by timer */
+	DS18_READING,		/* reading scratchpad */
+	DS18_ERROR		/* last conversion failed */
+} ds18b20_state;
+
+struct ds18b20;
+
+/* Conversion result; obj->temp is updated when status is 0 */
+typedef void (*ds18b20_cb_t)(struct ds18b20 *obj, int status, void *data);
+
 struct ds18b20 {
 	uint32_t port;
 	uint16_t pin;
 	struct ds18b20_temp temp;
-    uint8_t id[8];
-    int timer_id;
+	uint8_t id[8];
+	bool match_id;		/* address by id; else the only sensor on bus */
+	ds18b20_cb_t cb;
+	void *cb_data;
+	int timer_id;
+	ds18b20_state state;
+	uint16_t waited;	/* conversion time so far, msec */
 };
 
-
-// state of device
-typedef enum{
-    DS18_SLEEP,
-    DS18_RESETTING,
-    DS18_DETECTING,
-    DS18_DETDONE,
-    DS18_RDYTOSEND,
-    DS18_READING,
-    DS18_CONVERTIN,
-    DS18_ERROR
-} ds18b20_state;
-
-
 int ds18b20_init(struct ds18b20 *obj);
 void ds18b20_exit(struct ds18b20 *obj);
-struct ds18b20_temp ds18b20_read_temp(struct ds18b20 *obj);
+int ds18b20_start(struct ds18b20 *obj);
+int ds18b20_read_id(struct ds18b20 *obj);
 char *ds18b20_temp2str(struct ds18b20_temp *obj, char str[]);
 
-
-void ds18b20_convert_temp(struct ds18b20 *obj);
-struct ds18b20_temp ds18b20_read_temp_by_id(struct ds18b20 *obj, const uint8_t * id);
-void ds18b20_read_id(struct ds18b20 * obj);
-static int check_crc(const uint8_t data[9]);
-
-
 #endif /* DRIVERS_DS18B20_H */
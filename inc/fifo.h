@@ -52,4 +52,6 @@ err_t fifo_put(fifo_t *fifo, uint8_t *barr, uint32_t len);
 
 int32_t fifo_get(fifo_t *fifo, uint8_t *barr, uint32_t len);
 
+fifo_len_t fifo_used(fifo_t *fifo);
+
 #endif
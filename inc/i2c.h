@@ -1,8 +1,40 @@
 #ifndef DRIVERS_I2C_H
 #define DRIVERS_I2C_H
 
+#include "common.h"
 #include <stdint.h>
 
+/* i2c_xfer flags */
+#define I2C_XFER_REG		BIT(0)	/* send "reg" byte before tx_buf */
+#define I2C_XFER_DMA		BIT(1)	/* send tx_buf by DMA; write only */
+
+struct i2c_xfer;
+
+/* Called from ISR when transfer is finished; xfer->status holds result */
+typedef void (*i2c_xfer_cb_t)(struct i2c_xfer *xfer, void *data);
+
+/*
+ * Transfer descriptor for interrupt-driven mode.
+ *
+ * Write phase (reg and tx_buf) goes first, then read phase (rx_buf) after
+ * repeated START, if rx_len is not 0. Either phase can be empty, so the same
+ * descriptor describes write, read and write-then-read transactions.
+ * Descriptor must stay untouched until the transfer is finished.
+ */
+struct i2c_xfer {
+	uint8_t addr;		/* slave device 7-bit address */
+	uint8_t flags;		/* I2C_XFER_* */
+	uint8_t reg;		/* register address or control byte */
+	const uint8_t *tx_buf;	/* data to write */
+	uint16_t tx_len;
+	uint8_t *rx_buf;	/* buffer for data to read */
+	uint16_t rx_len;
+	i2c_xfer_cb_t cb;	/* optional */
+	void *cb_data;		/* user data passed to cb */
+	int task_id;		/* task to wake up on completion; 0 - none */
+	volatile int status;	/* -EINPROGRESS, then 0 or negative error */
+};
+
 int i2c_init(uint32_t base);
 int i2c_detect_device(uint8_t addr);
 int i2c_write_buf_poll(uint8_t addr, uint8_t reg, const uint8_t *buf,
@@ -10,4 +42,8 @@ int i2c_write_buf_poll(uint8_t addr, uint8_t reg, const uint8_t *buf,
 int i2c_read_single_byte_pol(uint8_t addr, uint8_t reg, uint8_t *data);
 int i2c_read_buf_poll(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+int i2c_xfer_start(struct i2c_xfer *xfer);
+int i2c_xfer_wait(struct i2c_xfer *xfer, uint32_t timeout);
+void i2c_xfer_abort(void);
+
 #endif /* DRIVERS_I2C_H */
@@ -0,0 +1,56 @@
+#ifndef DRIVERS_I2C_QUEUE_H
+#define DRIVERS_I2C_QUEUE_H
+
+#include "i2c.h"
+#include <stdint.h>
+
+/* Transaction priorities; lower value goes first */
+enum i2c_prio {
+	I2C_PRIO_HIGH,		/* short sensor transactions */
+	I2C_PRIO_NORMAL,
+	I2C_PRIO_LOW,		/* bulk transfers, e.g. display refresh */
+	I2C_PRIO_NR
+};
+
+struct i2c_txn;
+
+/* Called from ISR when transaction is finished; txn->status holds result */
+typedef void (*i2c_txn_cb_t)(struct i2c_txn *txn, void *data);
+
+/*
+ * Queued I2C transaction: write (reg, tx_buf), read (rx_buf) or
+ * write-then-read, same as struct i2c_xfer.
+ *
+ * Long write can be split into "chunk" bytes bus transfers, each one
+ * starting with "reg" again, so higher priority transactions can go in
+ * between. Only use it for devices where it makes sense (e.g. SSD1306 data
+ * stream continues where previous transfer stopped).
+ *
+ * Transaction must stay untouched until it's finished.
+ */
+struct i2c_txn {
+	uint8_t addr;		/* slave device 7-bit address */
+	uint8_t flags;		/* I2C_XFER_* */
+	uint8_t reg;		/* register address or control byte */
+	uint8_t prio;		/* enum i2c_prio */
+	const uint8_t *tx_buf;
+	uint16_t tx_len;
+	uint8_t *rx_buf;
+	uint16_t rx_len;
+	uint16_t chunk;		/* max write bytes per bus transfer; 0 - all */
+	i2c_txn_cb_t cb;	/* optional */
+	void *cb_data;		/* user data passed to cb */
+	int task_id;		/* task to wake up on completion; 0 - none */
+	volatile int status;	/* -EINPROGRESS, then 0 or negative error */
+
+	/* Queue internals */
+	struct i2c_txn *next;
+	uint16_t done;		/* write bytes already sent */
+};
+
+int i2c_queue_init(void);
+void i2c_queue_exit(void);
+int i2c_queue_submit(struct i2c_txn *txn);
+int i2c_queue_wait(struct i2c_txn *txn, uint32_t timeout);
+
+#endif /* DRIVERS_I2C_QUEUE_H */
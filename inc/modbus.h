@@ -0,0 +1,43 @@
+#ifndef MODBUS_H
+#define MODBUS_H
+
+#include <stdint.h>
+
+/* Slave address accepted by any SenseAir sensor, regardless of its own one */
+#define MODBUS_ADDR_ANY			0xfe
+
+/* Function codes */
+#define MODBUS_FC_READ_HOLDING		0x03
+#define MODBUS_FC_READ_INPUT		0x04
+#define MODBUS_FC_WRITE_SINGLE		0x06
+/* Set in function code of the reply when slave reports an exception */
+#define MODBUS_FC_EXCEPTION		0x80
+
+/* Exception codes */
+#define MODBUS_EX_ILLEGAL_FUNCTION	0x01
+#define MODBUS_EX_ILLEGAL_ADDRESS	0x02
+#define MODBUS_EX_ILLEGAL_VALUE		0x03
+
+/* Max registers count in one read request (limited by 256 bytes RTU frame) */
+#define MODBUS_READ_MAX			125
+
+/* Read request: addr, fc, start (2), count (2), crc (2) */
+#define MODBUS_READ_REQ_LEN		8
+/* Read reply: addr, fc, byte count, data (2 * count), crc (2) */
+#define MODBUS_READ_RESP_LEN(count)	(5 + 2 * (count))
+/* Exception reply: addr, fc | 0x80, exception code, crc (2) */
+#define MODBUS_EXCEPTION_LEN		5
+
+uint16_t modbus_crc16(const uint8_t *buf, uint16_t len);
+void modbus_build_read(uint8_t frame[MODBUS_READ_REQ_LEN], uint8_t addr,
+		       uint8_t fc, uint16_t start, uint16_t count);
+int modbus_check_read_resp(const uint8_t *frame, uint16_t len, uint8_t addr,
+			   uint8_t fc, uint16_t count);
+
+/* Get big-endian 16-bit register value from frame data */
+static inline uint16_t modbus_get_reg(const uint8_t *data, uint16_t idx)
+{
+	return (data[2 * idx] << 8) | data[2 * idx + 1];
+}
+
+#endif /* MODBUS_H */
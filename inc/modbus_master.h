@@ -0,0 +1,48 @@
+#ifndef MODBUS_MASTER_H
+#define MODBUS_MASTER_H
+
+#include "s8.h"
+#include <stdint.h>
+
+/* Max number of sensors on one RS-485 bus */
+#define MODBUS_MASTER_SLAVES_MAX	16
+
+/* Per-slave statistics */
+struct modbus_slave_stats {
+	uint32_t requests;	/* requests sent, including retries */
+	uint32_t replies;	/* valid replies */
+	uint32_t timeouts;
+	uint32_t bad_frames;	/* CRC errors, malformed or foreign replies */
+	uint32_t exceptions;	/* exception replies */
+	uint32_t samples;	/* complete poll cycles */
+	uint32_t latency_last;	/* usec, from request sent to reply received */
+	uint32_t latency_min;
+	uint32_t latency_max;
+	uint32_t latency_avg;	/* moving average, last ~8 replies */
+};
+
+/* Called from task context when the poll cycle of a slave is complete */
+typedef void (*modbus_sample_cb_t)(int idx, uint8_t addr,
+				   const struct s8_sample *sample, void *data);
+
+struct modbus_master_cfg {
+	uint32_t usart;		/* serial port of the bus */
+	uint32_t baud;		/* bus baud rate; for inter-frame gap */
+	const uint8_t *slaves;	/* slave addresses table */
+	uint8_t slave_nr;	/* slaves count */
+	uint8_t retries;	/* retries before slave goes to backoff */
+	uint16_t timeout;	/* reply timeout, msec */
+	uint16_t backoff_max;	/* max backoff for failing slave, msec */
+	modbus_sample_cb_t cb;	/* optional */
+	void *cb_data;		/* user data passed to cb */
+};
+
+int modbus_master_init(const struct modbus_master_cfg *cfg);
+void modbus_master_exit(void);
+void modbus_master_rx(uint8_t byte, void *data);
+void modbus_master_tc(void *data);
+int modbus_master_get_sample(int idx, struct s8_sample *sample);
+int modbus_master_get_stats(int idx, struct modbus_slave_stats *stats);
+uint32_t modbus_master_get_rate(void);
+
+#endif /* MODBUS_MASTER_H */
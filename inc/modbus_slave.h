@@ -0,0 +1,50 @@
+#ifndef MODBUS_SLAVE_H
+#define MODBUS_SLAVE_H
+
+#include <stdint.h>
+
+/* Input registers (read-only, FC 0x04): live measurements and statistics */
+enum modbus_slave_input {
+	MODBUS_IR_CO2,			/* ppm, first sensor on the bus */
+	MODBUS_IR_METER_STATUS,		/* S8 meter status; 0 - no errors */
+	MODBUS_IR_ALARM_STATUS,		/* S8 alarm status */
+	MODBUS_IR_TEMPERATURE,		/* 0.01 degC, signed; 0x8000 - no data */
+	MODBUS_IR_BUS_RATE,		/* samples per second on sensors bus */
+	MODBUS_IR_BUS_REQUESTS_HI,	/* sensors bus requests, all slaves */
+	MODBUS_IR_BUS_REQUESTS_LO,
+	MODBUS_IR_BUS_TIMEOUTS_HI,	/* sensors bus timeouts, all slaves */
+	MODBUS_IR_BUS_TIMEOUTS_LO,
+	MODBUS_IR_BUS_ERRORS_HI,	/* bad frames and exceptions, all slaves */
+	MODBUS_IR_BUS_ERRORS_LO,
+	MODBUS_IR_UPTIME_HI,		/* seconds since boot */
+	MODBUS_IR_UPTIME_LO,
+	MODBUS_IR_REQUESTS,		/* requests served by this slave */
+	MODBUS_IR_BAD_FRAMES,		/* requests dropped on CRC/length error */
+	MODBUS_IR_EXCEPTIONS,		/* exception replies sent */
+	MODBUS_IR_BUSY_DROPS,		/* requests dropped: reply still going out */
+	MODBUS_IR_NR
+};
+
+/* Holding registers (FC 0x03): device information and configuration */
+enum modbus_slave_holding {
+	MODBUS_HR_SLAVE_ADDR,		/* own Modbus address */
+	MODBUS_HR_BUS_SLAVES,		/* sensors configured on the bus */
+	MODBUS_HR_S8_TYPE_ID_HI,	/* S8 sensor type ID */
+	MODBUS_HR_S8_TYPE_ID_LO,
+	MODBUS_HR_S8_FW_VERSION,	/* main.sub in high/low byte */
+	MODBUS_HR_S8_ABC_PERIOD,	/* hours; 0 - ABC disabled */
+	MODBUS_HR_NR
+};
+
+struct modbus_slave_cfg {
+	uint32_t usart;		/* serial port; set idle_cb to modbus_slave_idle */
+	uint8_t addr;		/* own address, 1..247 */
+};
+
+int modbus_slave_init(const struct modbus_slave_cfg *cfg);
+void modbus_slave_idle(void *data);
+void modbus_slave_set_input(int reg, uint16_t val);
+void modbus_slave_set_input32(int reg, uint32_t val);
+void modbus_slave_set_holding(int reg, uint16_t val);
+
+#endif /* MODBUS_SLAVE_H */
@@ -0,0 +1,36 @@
+#ifndef OLED_CHART_H
+#define OLED_CHART_H
+
+#include "oled_ssd1306.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define OLED_CHART_MAX_WIDTH	SSD1306_WIDTH
+
+/*
+ * Trend chart: one sample per column, the newest one at the right edge.
+ * Scale follows the samples on screen, rounded to "step" units.
+ */
+struct oled_chart {
+	uint8_t x;		/* plot area on the screen */
+	uint8_t y;
+	uint8_t w;
+	uint8_t h;
+	uint16_t step;		/* scale granularity, sample units */
+	uint16_t lo;		/* current scale: bottom and top values */
+	uint16_t hi;
+	/* Ring buffer; one extra sample joins the leftmost column */
+	uint16_t samples[OLED_CHART_MAX_WIDTH + 1];
+	uint8_t head;		/* where the next sample goes */
+	uint8_t count;		/* samples in ring buffer, up to w + 1 */
+	bool scaled;		/* lo/hi are valid */
+	bool hw_scroll;		/* scroll by hardware: page-aligned, supported */
+};
+
+int oled_chart_init(struct oled_chart *chart, uint8_t x, uint8_t y,
+		    uint8_t w, uint8_t h, uint16_t step);
+void oled_chart_push(struct oled_chart *chart, uint16_t value);
+void oled_chart_add(struct oled_chart *chart, uint16_t value);
+void oled_chart_redraw(struct oled_chart *chart);
+
+#endif /* OLED_CHART_H */
@@ -0,0 +1,35 @@
+#ifndef OLED_GRAY_H
+#define OLED_GRAY_H
+
+#include "swtimer.h"
+#include <stdint.h>
+
+/* Shades 0 (black) .. 3 (white), one bit per plane */
+#define OLED_GRAY_SHADES	4
+#define OLED_GRAY_PLANES	2
+
+/* Plane contrasts: bit 1 plane is lit twice as bright as bit 0 one */
+#define OLED_GRAY_CONTRAST_LO	0x7f
+#define OLED_GRAY_CONTRAST_HI	0xff
+
+/* Counters since oled_gray_start() */
+struct oled_gray_stats {
+	uint32_t ticks;		/* plane timer ticks */
+	uint32_t shown;		/* planes sent */
+	uint32_t missed;	/* ticks with previous plane still going out */
+	uint32_t cycles;	/* CPU cycles in plane timer ISR, total */
+	uint32_t cycles_max;	/* CPU cycles of the longest tick */
+};
+
+int oled_gray_init(const struct swtimer_hw_tim *hw_tim);
+void oled_gray_start(void);
+void oled_gray_stop(void);
+void oled_gray_set_contrast(uint8_t lo, uint8_t hi);
+void oled_gray_fill(uint8_t shade);
+void oled_gray_fill_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,
+			 uint8_t shade);
+void oled_gray_pixel(uint8_t x, uint8_t y, uint8_t shade);
+void oled_gray_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t shade);
+void oled_gray_get_stats(struct oled_gray_stats *stats);
+
+#endif /* OLED_GRAY_H */
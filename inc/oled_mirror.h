@@ -0,0 +1,26 @@
+#ifndef OLED_MIRROR_H
+#define OLED_MIRROR_H
+
+#include <stdint.h>
+
+/*
+ * TELEMETRY_OLED record payload: flags, offset (2), then tokens updating
+ * framebuffer bytes (display RAM layout) from offset on:
+ *   0x00..0x7f: n + 1 bytes unchanged
+ *   0x80..0xff: n + 1 bytes follow, XOR them into the framebuffer
+ */
+#define OLED_MIRROR_RESET	0x01	/* flags: clear the picture first */
+#define OLED_MIRROR_HDR_LEN	3
+#define OLED_MIRROR_RUN_MAX	128
+
+/* Record period, msec: one record per period at most */
+#define OLED_MIRROR_PERIOD	25
+/* Whole picture is sent again this often, for hosts connected late */
+#define OLED_MIRROR_KEY_PERIOD	10000
+
+int oled_mirror_init(uint32_t usart);
+uint16_t oled_mirror_encode(const uint8_t *frame, const uint8_t *shadow,
+			    uint16_t *pos, uint8_t *out, uint16_t max);
+uint32_t oled_mirror_get_bytes(void);
+
+#endif /* OLED_MIRROR_H */
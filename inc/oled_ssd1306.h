@@ -4,6 +4,7 @@
 #include "common.h"
 #include "ssd1306_fonts.h"
 #include "errors.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 
@@ -45,7 +46,10 @@ typedef enum {
 } oled_err_t;
 
 
+struct ssd1306_bus;
+
 typedef struct {
+    const struct ssd1306_bus *bus;  /* transport; NULL: I2C */
     uint32_t i2c;
 	uint32_t addr;
 	uint16_t x_pos;
@@ -61,20 +65,62 @@ typedef struct {
     uint8_t y;
 } oledd_vertex_t;
 
+typedef enum ssd1306_scroll_dir {
+    SSD1306_SCROLL_RIGHT,
+    SSD1306_SCROLL_LEFT
+} ssd1306_scroll_dir_t;
+
+/* Rectangle, corners inclusive */
+typedef struct {
+    uint8_t x0;
+    uint8_t y0;
+    uint8_t x1;
+    uint8_t y1;
+} oled_rect_t;
+
+/* Bitmap asset (tools/icon_compiler.py), page layout, maybe RLE */
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t flags;          /* BITMAP_* flags */
+    const uint8_t *data;
+} bitmap_def_t;
+
+/* Bitmap data is run-length encoded */
+#define BITMAP_RLE		0x01
+
+/* Presented frame is on the screen; called from ISR */
+typedef void (*ssd1306_present_cb_t)(void *data);
+
 
 // Procedure definitions
 void ssd1306_init(oled_ssd1306_t * obj);
 void ssd1306_fill(oled_color_t color);
 void ssd1306_update_screen(void);
+int ssd1306_present(ssd1306_present_cb_t cb, void *data);
+void ssd1306_set_plane_mode(bool on);
+int ssd1306_present_plane(const uint8_t *plane, uint8_t contrast);
 void ssd1306_draw_pixel(uint8_t x, uint8_t y, oled_color_t color);
 char ssd1306_write_char(oled_ssd1306_t *obj, char ch, font_def_t font, oled_color_t color);
 char ssd1306_write_string(oled_ssd1306_t *obj, char* str, font_def_t font, oled_color_t color);
 void ssd1306_set_cursor(oled_ssd1306_t *obj, uint8_t x, uint8_t y);
+const uint8_t *ssd1306_get_buffer(void);
+const uint8_t *ssd1306_get_frame(void);
+int ssd1306_draw_bitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *bitmap, oled_color_t color);
+void ssd1306_blit(const bitmap_def_t *bmp, int16_t x, int16_t y, oled_color_t color, const oled_rect_t *clip);
 void ssd1306_line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, oled_color_t color);
 void ssd1306_draw_arc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep, oled_color_t color);
 void ssd1306_draw_circle(uint8_t par_x, uint8_t par_y, uint8_t par_r, oled_color_t color);
 void ssd1306_polyline(const oledd_vertex_t *par_vertex, uint16_t par_size, oled_color_t color);
 void ssd1306_draw_rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, oled_color_t color);
+void ssd1306_fill_rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, oled_color_t color);
+void ssd1306_hline(uint8_t x1, uint8_t x2, uint8_t y, oled_color_t color);
+void ssd1306_vline(uint8_t x, uint8_t y1, uint8_t y2, oled_color_t color);
+void ssd1306_shift_left(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t n);
+// Hardware scroll
+int ssd1306_scroll_start(uint8_t page0, uint8_t page1, enum ssd1306_scroll_dir dir, uint8_t interval, uint8_t voffset);
+int ssd1306_scroll_stop(void);
+int ssd1306_scroll_step(uint8_t page0, uint8_t page1, uint8_t x0, uint8_t x1, enum ssd1306_scroll_dir dir);
 /**
  * @brief Sets the contrast of the display.
  * @param[in] value contrast to set.
@@ -97,6 +143,7 @@ uint8_t ssd1306_get_display_on(void);
 // Low-level procedures
 void ssd1306_reset(oled_ssd1306_t * obj);
 int  ssd1306_write_cmd(uint8_t byte);
+int ssd1306_write_cmds(const uint8_t *cmds, uint16_t len);
 int ssd1306_write_data(uint8_t* buffer, uint16_t buff_size);
 oled_err_t ssd1306_fill_buffer(uint8_t* buf, uint16_t len);
 
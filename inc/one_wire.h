@@ -3,15 +3,25 @@
 
 #include <stdint.h>
 
+/* Max bytes in one ow_xfer_start() transaction */
+#define OW_XFER_MAX	16
+
+/* Backends: one_wire.c (GPIO) or one_wire_uart.c (USART, make OW_UART=1) */
 struct ow {
-	uint32_t port;
-	uint16_t pin;
+	uint32_t port;		/* GPIO backend only */
+	uint16_t pin;		/* GPIO backend only */
 };
 
+/* Transaction finished; status is 0 or negative error */
+typedef void (*ow_done_t)(struct ow *obj, int status, void *data);
+
 int ow_init(struct ow *obj);
 void ow_exit(struct ow *obj);
 int ow_reset_pulse(struct ow *obj);
 void ow_write_byte(struct ow *obj, uint8_t byte);
 int8_t ow_read_byte(struct ow *obj);
+uint16_t ow_read_bit(struct ow *obj);
+int ow_xfer_start(struct ow *obj, const uint8_t *tx, uint8_t *rx, uint8_t len,
+		  ow_done_t cb, void *data);
 
 #endif /* DRIVERS_ONE_WIRE_H */
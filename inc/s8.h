@@ -0,0 +1,61 @@
+#ifndef S8_H
+#define S8_H
+
+#include <stdint.h>
+
+/* Poll divider for the registers that almost never change */
+#define S8_SLOW_RATE		12
+/* Max number of Modbus read transactions the register map is merged into */
+#define S8_BATCH_MAX		4
+/* Max registers in one read transaction */
+#define S8_BATCH_REGS_MAX	16
+
+/* SenseAir S8 registers we are interested in */
+enum s8_reg {
+	S8_METER_STATUS,
+	S8_ALARM_STATUS,
+	S8_OUTPUT_STATUS,
+	S8_SPACE_CO2,
+	S8_TYPE_ID_HI,
+	S8_TYPE_ID_LO,
+	S8_MAP_VERSION,
+	S8_FW_VERSION,
+	S8_ABC_PERIOD,
+	S8_REG_NR
+};
+
+/* Decoded registers of one sensor */
+struct s8_sample {
+	uint16_t meter_status;	/* 0 - no errors */
+	uint16_t alarm_status;
+	uint16_t output_status;
+	uint16_t co2;		/* space CO2, ppm */
+	uint16_t type_id_hi;
+	uint16_t type_id_lo;
+	uint16_t map_version;
+	uint16_t fw_version;	/* main.sub in high/low byte */
+	uint16_t abc_period;	/* hours; 0 - ABC disabled */
+	uint16_t valid;		/* bitmask of updated registers, BIT(s8_reg) */
+	uint32_t timestamp;	/* msec, when the sample was read */
+};
+
+/* One merged Modbus read transaction */
+struct s8_batch {
+	uint8_t fc;		/* function code: input or holding registers */
+	uint8_t rate;		/* poll divider */
+	uint16_t start;		/* first register address */
+	uint16_t count;		/* registers count */
+};
+
+/* Poll sequence state; one per sensor */
+struct s8_poller {
+	uint32_t cycle;		/* poll cycles done */
+	uint8_t next;		/* next batch to check in this cycle */
+};
+
+int s8_init(void);
+const struct s8_batch *s8_next_batch(struct s8_poller *poller);
+void s8_decode(const struct s8_batch *batch, const uint8_t *data,
+	       struct s8_sample *sample);
+
+#endif /* S8_H */
@@ -8,6 +8,7 @@
 #include "common.h"
 #include "errors.h"
 #include "fifo.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 
@@ -18,18 +19,15 @@
 
 #define UNUSED(x)		((void)x)
 
-extern uint32_t serial_usart;
-
 /* FIFO related definition */
 #define FIFO_SIZE 128
-fifo_t rx_fifo;
-fifo_t tx_fifo;
-uint8_t rx_buff[FIFO_SIZE];
-uint8_t tx_buff[FIFO_SIZE];
-
-
-
 
+/* Called from ISR for each received byte */
+typedef void (*serial_rx_cb_t)(uint8_t byte, void *data);
+/* Called from ISR when the last byte has left the shift register */
+typedef void (*serial_tc_cb_t)(void *data);
+/* Called from ISR when RX line goes idle after reception (end of frame) */
+typedef void (*serial_idle_cb_t)(void *data);
 
 struct serial_device {
 	uint32_t uart;
@@ -39,14 +37,40 @@ struct serial_device {
 	uint32_t parity;
 	uint32_t mode;
 	uint32_t flow_control;
+	uint32_t de_port;	/* RS-485 driver enable GPIO port; 0 if unused */
+	uint16_t de_pin;	/* RS-485 driver enable GPIO pin */
+	serial_rx_cb_t rx_cb;	/* optional */
+	serial_tc_cb_t tc_cb;	/* optional */
+	serial_idle_cb_t idle_cb; /* optional */
+	void *cb_data;		/* user data passed to callbacks */
 };
 
+/* Cumulative port counters, see serial_get_stats() */
+struct serial_stats {
+	uint32_t noise;		/* RX bytes with noise flag */
+	uint32_t overrun;	/* RX overruns (at least one byte lost each) */
+	uint32_t frame;		/* RX framing errors */
+	uint32_t parity;	/* RX parity errors */
+	uint32_t rx_drops;	/* RX bytes dropped on RX FIFO overflow */
+	uint32_t tx_drops;	/* TX bytes rejected on TX FIFO overflow */
+	uint32_t rx_bytes;	/* bytes received */
+	uint32_t tx_bytes;	/* bytes sent */
+	fifo_len_t rx_hwm;	/* RX FIFO high-water mark, bytes */
+	fifo_len_t tx_hwm;	/* TX FIFO high-water mark, bytes */
+};
 
 int serial_init(struct serial_device *params);
-void serial_exit(void);
+void serial_exit(uint32_t usart);
+
+int serial_send_fifo(uint32_t usart, uint8_t *buff, fifo_len_t len);
+
+int serial_send_frame(uint32_t usart, const uint8_t *buff, uint16_t len);
+bool serial_frame_busy(uint32_t usart);
 
-int serial_send_fifo(uint32_t serial_usart, uint8_t *buff, fifo_len_t len);
+int serial_receive_fifo(uint32_t usart, uint8_t *buff, fifo_len_t len);
 
-int serial_receive_fifo(uint32_t serial_usart, uint8_t *buff, fifo_len_t len);
+int serial_get_stats(uint32_t usart, struct serial_stats *stats);
+void serial_reset_stats(uint32_t usart);
+fifo_len_t serial_get_tx_free(uint32_t usart);
 
 #endif /* SERIAL_H */
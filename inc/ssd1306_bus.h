@@ -0,0 +1,48 @@
+#ifndef SSD1306_BUS_H
+#define SSD1306_BUS_H
+
+#include "oled_ssd1306.h"
+#include <stdint.h>
+
+#define SSD1306_PAGES		(SSD1306_HEIGHT / 8)
+
+/*
+ * One address window of the flush: column/page address commands (0x21/0x22)
+ * followed by the window data. Horizontal addressing mode wraps within the
+ * window, so several full-width pages go as one window. A plane (see
+ * ssd1306_present_plane()) has contrast command (0x81) in front.
+ */
+struct ssd1306_win {
+	uint8_t cmds[8];
+	uint8_t cmd_len;
+	uint8_t idx;		/* window number in the frame */
+	const uint8_t *data;
+	uint16_t len;
+};
+
+/*
+ * Display transport. The core (oled_ssd1306.c) keeps the framebuffers and
+ * decides what to send; the bus only moves bytes to the controller.
+ */
+struct ssd1306_bus {
+	const char *name;
+	/* Set up the bus and power the controller; obj carries bus params */
+	int (*init)(const oled_ssd1306_t *obj);
+	/* Hardware reset of the controller; NULL if there is no RST line */
+	void (*reset)(void);
+	/* Blocking write of commands (COMMAND) or data (DATAONLY) */
+	int (*write)(uint8_t dc, const uint8_t *buf, uint16_t len);
+	/*
+	 * Queue window for sending in interrupts; ssd1306_flush_done() is
+	 * called when it is out. Up to SSD1306_PAGES windows per frame.
+	 */
+	int (*flush)(const struct ssd1306_win *win);
+};
+
+extern const struct ssd1306_bus ssd1306_i2c_bus;
+extern const struct ssd1306_bus ssd1306_spi_bus;
+
+/* Window went out (status 0) or was lost; called from ISR */
+void ssd1306_flush_done(const struct ssd1306_win *win, int status);
+
+#endif /* SSD1306_BUS_H */
@@ -11,18 +11,40 @@ typedef struct {
 	const uint8_t font_width;    /*!< Font width in pixels */
 	uint8_t font_height;   /*!< Font height in pixels */
 	const uint16_t *data; /*!< Pointer to data font data array */
+	const uint8_t *pages; /*!< Same glyphs in SSD1306 page layout, or NULL */
+	const uint8_t *packed; /*!< Bit-packed glyphs (tools/font_compiler.py) */
+	const uint16_t *offsets; /*!< Offset of each packed glyph, in bytes */
+	const char *chars;    /*!< Characters in glyph order; NULL: 32..126 */
+	uint8_t flags;        /*!< FONT_* flags */
 } font_def_t;
 
+/* Packed glyphs are run-length encoded */
+#define FONT_RLE		0x01
+/* Max glyph size the renderer decodes (one column fits 32 bits) */
+#define FONT_MAX_WIDTH		32
+#define FONT_MAX_HEIGHT		32
+
+/*
+ * Page layout glyph (see tools/font_pages.py): ceil(font_height / 8) rows of
+ * font_width bytes, bit 0 is the top pixel of the column.
+ */
+#define FONT_PAGES(font)	(((font).font_height + 7) / 8)
+#define FONT_GLYPH_SIZE(font)	((font).font_width * FONT_PAGES(font))
+
 #ifdef SSD1306_INCLUDE_FONT_6x8
 extern font_def_t font_6x8;
+extern const uint8_t font6x8_pages[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
 extern font_def_t font_7x10;
+extern const uint8_t font7x10_pages[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
 extern font_def_t font_11x18;
+extern const uint8_t font11x18_pages[];
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x26
 extern font_def_t font_16x26;
+extern const uint8_t font16x26_pages[];
 #endif
 #endif // __SSD1306_FONTS_H__
@@ -0,0 +1,19 @@
+/* Generated by tools/icon_compiler.py, do not edit */
+
+#ifndef SSD1306_ICONS_H
+#define SSD1306_ICONS_H
+
+#include "oled_ssd1306.h"
+
+extern const bitmap_def_t icon_alarm_high;
+extern const bitmap_def_t icon_alarm_warn;
+extern const bitmap_def_t icon_battery_0;
+extern const bitmap_def_t icon_battery_1;
+extern const bitmap_def_t icon_battery_2;
+extern const bitmap_def_t icon_battery_3;
+extern const bitmap_def_t icon_link;
+extern const bitmap_def_t icon_link_off;
+extern const bitmap_def_t icon_sensor_fault;
+extern const bitmap_def_t icon_sensor_ok;
+
+#endif /* SSD1306_ICONS_H */
@@ -0,0 +1,72 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+
+/*
+ * Frame on the wire: COBS(type, seq, payload, crc16) followed by 0x00.
+ * Multi-byte fields are little-endian; CRC is Modbus CRC16 over type, seq
+ * and payload.
+ */
+#define TELEMETRY_DELIM		0x00
+#define TELEMETRY_PAYLOAD_MAX	64
+/* type, seq, payload, crc */
+#define TELEMETRY_RAW_MAX	(2 + TELEMETRY_PAYLOAD_MAX + 2)
+/* COBS adds 1 byte per 254 bytes (and one at least), plus delimiter */
+#define TELEMETRY_FRAME_MAX	(TELEMETRY_RAW_MAX + TELEMETRY_RAW_MAX / 254 + 2)
+
+/* Temperature value meaning "no sensor" */
+#define TELEMETRY_TEMP_NA	INT16_MIN
+
+enum telemetry_type {
+	TELEMETRY_SAMPLE = 1,	/* sensor, co2 (2), status (2), temp (2) */
+	TELEMETRY_STATS = 2,	/* struct telemetry_stats */
+	TELEMETRY_EVENT = 3,	/* code, arg (4) */
+	TELEMETRY_OLED = 4,	/* display changes, see oled_mirror.h */
+	TELEMETRY_BUS_SLAVE = 5, /* struct telemetry_bus_slave */
+};
+
+enum telemetry_event {
+	TELEMETRY_EV_BOOT = 1,		/* arg: 0 */
+	TELEMETRY_EV_SENSOR_FAULT,	/* arg: sensor << 16 | meter status */
+	TELEMETRY_EV_SENSOR_OK,		/* arg: sensor */
+};
+
+/* Stats record payload, in wire order */
+struct telemetry_stats {
+	uint32_t uptime;	/* msec */
+	uint16_t bus_rate;	/* sensors bus samples per second */
+	uint32_t bus_requests;
+	uint32_t bus_timeouts;
+	uint32_t bus_errors;	/* bad frames and exceptions */
+	uint32_t line_errors;	/* noise, overrun, framing, parity */
+	uint32_t rx_drops;	/* sensors bus RX FIFO overflow drops */
+	uint16_t rx_hwm;	/* sensors bus RX FIFO high-water mark */
+	uint32_t drops;		/* telemetry frames dropped on TX FIFO full */
+};
+
+/* Sensors bus slave record payload, in wire order */
+struct telemetry_bus_slave {
+	uint8_t sensor;		/* index on the bus */
+	uint8_t addr;		/* Modbus address */
+	uint32_t requests;	/* including retries */
+	uint32_t replies;
+	uint32_t timeouts;
+	uint32_t errors;	/* bad frames and exceptions */
+	uint32_t latency_last;	/* usec, request sent to reply received */
+	uint32_t latency_min;
+	uint32_t latency_max;
+	uint32_t latency_avg;
+};
+
+int telemetry_init(uint32_t usart);
+int telemetry_send(uint8_t type, const uint8_t *payload, uint16_t len);
+int telemetry_send_sample(uint8_t sensor, uint16_t co2, uint16_t status,
+			  int16_t temp);
+int telemetry_send_stats(const struct telemetry_stats *stats);
+int telemetry_send_bus_slave(const struct telemetry_bus_slave *slave);
+int telemetry_send_event(uint8_t code, uint32_t arg);
+uint32_t telemetry_get_drops(void);
+uint16_t telemetry_cobs_encode(const uint8_t *src, uint16_t len, uint8_t *dst);
+
+#endif /* TELEMETRY_H */
@@ -0,0 +1,109 @@
+#ifndef UI_H
+#define UI_H
+
+#include "oled_ssd1306.h"
+#include "oled_chart.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Default frame rate limit */
+#define UI_FPS_DEFAULT		10
+/* Max characters in label and numeric field */
+#define UI_TEXT_MAX		16
+
+struct ui_widget;
+
+typedef void (*ui_draw_t)(struct ui_widget *w);
+
+/*
+ * Widget base; embedded as the first member of every widget. Widgets keep
+ * their own state and redraw only their own rectangle when it changes.
+ */
+struct ui_widget {
+	ui_draw_t draw;		/* draw widget contents into its rectangle */
+	uint8_t x;
+	uint8_t y;
+	uint8_t w;
+	uint8_t h;
+	bool dirty;		/* needs redraw on the next frame */
+	bool damaged;		/* rectangle was cleared: draw all of it */
+	struct ui_widget *next;
+};
+
+/* Widgets shown together; one screen is shown at a time */
+struct ui_screen {
+	struct ui_widget *first;
+	struct ui_widget *last;
+};
+
+/* Static or rarely changed text */
+struct ui_label {
+	struct ui_widget base;
+	const font_def_t *font;
+	char text[UI_TEXT_MAX + 1];
+};
+
+/*
+ * Right-aligned unsigned number in a fixed number of digit cells. Only the
+ * cells whose character changed are drawn again.
+ */
+struct ui_number {
+	struct ui_widget base;
+	const font_def_t *font;
+	uint8_t digits;
+	bool valid;		/* false: shows dashes */
+	uint32_t value;
+	uint32_t max;		/* largest value that fits */
+	char shown[UI_TEXT_MAX];	/* cells on screen, '\0': unknown */
+};
+
+/* Bitmap asset (see ssd1306_blit()); icons shown in it are of one size */
+struct ui_icon {
+	struct ui_widget base;
+	const bitmap_def_t *bitmap;	/* NULL: blank */
+};
+
+/* Trend chart; draws itself incrementally, see oled_chart.c */
+struct ui_chart {
+	struct ui_widget base;
+	struct oled_chart chart;
+};
+
+/* Menu: list of items, selected one is inverted; scrolls to selection */
+struct ui_menu {
+	struct ui_widget base;
+	const font_def_t *font;
+	const char * const *items;
+	uint8_t nr;
+	uint8_t rows;		/* visible rows */
+	uint8_t top;		/* first visible item */
+	uint8_t sel;		/* selected item */
+};
+
+int ui_init(uint8_t fps);
+void ui_screen_add(struct ui_screen *scr, struct ui_widget *w);
+void ui_show(struct ui_screen *scr);
+void ui_invalidate(struct ui_widget *w);
+void ui_request_frame(void);
+uint32_t ui_get_frames(void);
+
+void ui_label_init(struct ui_label *l, uint8_t x, uint8_t y, uint8_t w,
+		   const font_def_t *font, const char *text);
+void ui_label_set(struct ui_label *l, const char *text);
+void ui_number_init(struct ui_number *n, uint8_t x, uint8_t y, uint8_t digits,
+		    const font_def_t *font);
+void ui_number_set(struct ui_number *n, uint32_t value);
+void ui_number_clear(struct ui_number *n);
+void ui_icon_init(struct ui_icon *i, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t h, const bitmap_def_t *bitmap);
+void ui_icon_set(struct ui_icon *i, const bitmap_def_t *bitmap);
+int ui_chart_init(struct ui_chart *c, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t h, uint16_t step);
+void ui_chart_add(struct ui_chart *c, uint16_t value);
+void ui_menu_init(struct ui_menu *m, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t rows, const font_def_t *font,
+		  const char * const *items, uint8_t nr);
+void ui_menu_select(struct ui_menu *m, uint8_t sel);
+void ui_menu_move(struct ui_menu *m, int8_t delta);
+
+#endif /* UI_H */
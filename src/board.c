@@ -39,17 +39,66 @@ static struct pin_mode pins[] = {
 		.conf = GPIO_CNF_INPUT_FLOAT,
 		.pull = PULL_UP,
 	},
+	{
+		.port = RS485_DE_PORT,
+		.pins = RS485_DE_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_PUSHPULL,
+	},
+	{
+		.port = HOST_GPIO_PORT,
+		.pins = HOST_GPIO_TX_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_ALTFN_PUSHPULL,
+	},
+	{
+		.port = HOST_GPIO_PORT,
+		.pins = HOST_GPIO_RX_PIN,
+		.mode = GPIO_MODE_INPUT,
+		.conf = GPIO_CNF_INPUT_FLOAT,
+	},
+	{
+		.port = HOST_DE_PORT,
+		.pins = HOST_DE_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_PUSHPULL,
+	},
 	{
 		.port = I2C_GPIO_PORT,
 		.pins = I2C_SCL_PIN | I2C_SDA_PIN,
 		.mode = GPIO_MODE_OUTPUT_10_MHZ, 
 		.conf = GPIO_CNF_OUTPUT_ALTFN_OPENDRAIN,
 	},
+#if USE_OLED_SPI
+	{
+		.port = OLED_SPI_GPIO_PORT,
+		.pins = OLED_SPI_SCK_PIN | OLED_SPI_MOSI_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_ALTFN_PUSHPULL,
+	},
+	{
+		.port = OLED_CS_PORT,
+		.pins = OLED_CS_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_PUSHPULL,
+		.pull = PULL_UP,	/* deselected */
+	},
+	{
+		.port = OLED_DC_PORT,
+		.pins = OLED_DC_PIN | OLED_RST_PIN,
+		.mode = GPIO_MODE_OUTPUT_50_MHZ,
+		.conf = GPIO_CNF_OUTPUT_PUSHPULL,
+	},
+#endif
     {
         .port = DS18B20_GPIO_PORT,
         .pins = DS18B20_GPIO_PIN,
         .mode = GPIO_MODE_OUTPUT_10_MHZ,
+#if USE_OW_UART
+        .conf = GPIO_CNF_OUTPUT_ALTFN_OPENDRAIN,
+#else
         .conf = GPIO_CNF_OUTPUT_OPENDRAIN,
+#endif
     },
 };
 
@@ -58,10 +107,20 @@ enum rcc_periph_clken clocks[] = {
 	RCC_AFIO,
 	SERIAL_GPIO_RCC,
 	SERIAL_USART_RCC,
+	HOST_GPIO_RCC,
+	HOST_USART_RCC,
 	I2C_GPIO_RCC,
 	I2C_RCC,
+	I2C_DMA_RCC,
+#if USE_OLED_SPI
+	OLED_SPI_RCC,
+#endif
 	DS18B20_GPIO_RCC,
+#if USE_OW_UART
+	OW_USART_RCC,
+#endif
 	SWTIMER_TIM_RCC,
+	OLED_GRAY_TIM_RCC,
 };
 
 
@@ -4,20 +4,24 @@
 
 #include <one_wire.h>
 #include <common.h>
+#include <swtimer.h>
 #include <libopencm3/stm32/gpio.h>
+#include <errno.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include "libprintf/printf.h"
 
+/* Max conversion time (750 ms at 12 bits), with margin; msec */
 #define TEMPERATURE_CONV_TIME		900
+/* How often conversion-done is polled on the bus, msec */
+#define DS18B20_POLL_PERIOD		10
 
 #define CMD_READ_SCRATCHPAD		0xbe
+#define DS18B20_SCRATCHPAD_LEN		9
 
 static struct ow ow;
 
-static ds18b20_state ds_state = DS18_SLEEP;
-
 /*
  * thermometer commands
  * send them with bus reset!
@@ -109,127 +113,158 @@ static struct ds18b20_temp ds18b20_parse_temp(uint8_t lsb, uint8_t msb)
 }
 
 
-/**
- * Send command to all DS18B20 sensors conevert temperature.
- *
- * @param obj 1-wire device object
- * @return Parsed value
+/*
+ * Reset and address the sensor: by ROM ID, or the only one on the bus.
+ * Returns -ENODEV if nobody answers the reset.
  */
-void ds18b20_convert_temp(struct ds18b20 *obj)
+static int ds18b20_select(struct ds18b20 *obj)
 {
+	size_t i;
 
-	ow_reset_pulse(&ow);
-	ow_write_byte(&ow, OW_SKIP_ROM);
-	ow_write_byte(&ow, OW_CONVERT_T);
-    ds_state = DS18_CONVERTIN;	
+	if (ow_reset_pulse(&ow))
+		return -ENODEV;
+
+	if (obj->match_id) {
+		ow_write_byte(&ow, OW_MATCH_ROM);
+		for (i = 0; i < 8; i++)
+			ow_write_byte(&ow, obj->id[i]);
+	} else {
+		ow_write_byte(&ow, OW_SKIP_ROM);
+	}
+
+	return 0;
 }
 
-/**
- * Read temperature register from DS18B20.
- *
- * @param obj 1-wire device object
- * @return Parsed value
- */
-struct ds18b20_temp ds18b20_read_temp(struct ds18b20 *obj)
+/* Dallas/Maxim CRC8 (x^8 + x^5 + x^4 + 1); 0 over data with its CRC */
+static uint8_t ds18b20_crc8(const uint8_t *data, size_t len)
+{
+	uint8_t crc = 0;
+	size_t n;
+	int i;
+
+	for (n = 0; n < len; n++) {
+		crc ^= data[n];
+		for (i = 0; i < 8; i++) {
+			if (crc & 1)
+				crc = (crc >> 1) ^ 0x8c;
+			else
+				crc >>= 1;
+		}
+	}
+
+	return crc;
+}
+
+/* Read and check scratchpad, parse temperature into obj */
+static int ds18b20_read_scratchpad(struct ds18b20 *obj)
 {
-	unsigned long flags;
-	uint8_t data[2];
+	uint8_t data[DS18B20_SCRATCHPAD_LEN];
 	size_t i;
+	int ret;
 
-    ow_reset_pulse(&ow);
-	ow_write_byte(&ow, OW_SKIP_ROM);
-	ow_write_byte(&ow, OW_CONVERT_T);
-	
-    enter_critical(flags);
-	mdelay(TEMPERATURE_CONV_TIME); // 900ms :)
-	exit_critical(flags);
+	ret = ds18b20_select(obj);
+	if (ret)
+		return ret;
 
-    ow_reset_pulse(&ow);
-	ow_write_byte(&ow, OW_SKIP_ROM);
 	ow_write_byte(&ow, OW_READ_SCRATCHPAD);
-
-	for (i = 0; i < 2; i++)
+	for (i = 0; i < DS18B20_SCRATCHPAD_LEN; i++)
 		data[i] = ow_read_byte(&ow);
 	ow_reset_pulse(&ow);
 
+	/* Released bus reads all ones, its CRC does not match */
+	if (ds18b20_crc8(data, DS18B20_SCRATCHPAD_LEN))
+		return -EIO;
+
 	obj->temp = ds18b20_parse_temp(data[0], data[1]);
-	return obj->temp;
+	return 0;
 }
 
-/**
- * Read ds18b20 ROM ID
- *
- * @param obj Contains parsed temperature register from DS18B20
- * @return
+/* Conversion is over: stop polling and report */
+static void ds18b20_finish(struct ds18b20 *obj, int status)
+{
+	swtimer_tim_stop(obj->timer_id);
+	obj->state = status ? DS18_ERROR : DS18_SLEEP;
+	if (obj->cb)
+		obj->cb(obj, status, obj->cb_data);
+}
+
+/*
+ * Poll timer (task context): sensor holds read slots at 0 while it
+ * converts, so one slot per tick tells when the result is ready.
  */
-void ds18b20_read_id(struct ds18b20 * obj)
+static void ds18b20_tick(void *data)
 {
-    size_t i;
+	struct ds18b20 *obj = data;
 
-	ow_reset_pulse(&ow);
-	ow_write_byte(&ow, OW_READ_ROM); // 33h
-    for (i = 0; i < 8; i++)
-        obj->id[i] = ow_read_byte(&ow);
-}
+	if (obj->state != DS18_CONVERTIN)
+		return;
+
+	obj->waited += DS18B20_POLL_PERIOD;
+	if (!ow_read_bit(&ow)) {
+		if (obj->waited >= TEMPERATURE_CONV_TIME)
+			ds18b20_finish(obj, -ETIMEDOUT);
+		return;
+	}
 
+	obj->state = DS18_READING;
+	ds18b20_finish(obj, ds18b20_read_scratchpad(obj));
+}
 
 /**
- * Check CRC of the 9 byte msg
+ * Start temperature conversion. Returns right away; when the result is
+ * read (or on error), obj->cb is called from the swtimer task.
  *
- * @param input msg
- * @return 1 if msg CRC match last byte
+ * Sensor must be powered from VDD pin: in parasite power mode
+ * conversion-done can't be polled.
+ *
+ * @param obj Sensor object
+ * @return 0 on success, -EBUSY if conversion is running or -ENODEV if no
+ *         sensor answers
  */
+int ds18b20_start(struct ds18b20 *obj)
+{
+	int ret;
+
+	if (obj->state == DS18_CONVERTIN || obj->state == DS18_READING)
+		return -EBUSY;
+
+	ret = ds18b20_select(obj);
+	if (ret) {
+		obj->state = DS18_ERROR;
+		return ret;
+	}
+	ow_write_byte(&ow, OW_CONVERT_T);
+
+	obj->state = DS18_CONVERTIN;
+	obj->waited = 0;
+	swtimer_tim_reset(obj->timer_id);
+	swtimer_tim_start(obj->timer_id);
 
-static int check_crc(const uint8_t data[9]){
-    uint8_t crc = 0;
-    for(int n = 0; n < 8; ++n){
-        crc = crc ^ data[n];
-           for(int i = 0; i < 8; i++){
-               if(crc & 1)
-                   crc = (crc >> 1) ^ 0x8C;
-               else
-                   crc >>= 1;
-           }
-    }
-    if(data[8] == crc) return 0;
-    return 1;
+	return 0;
 }
 
 /**
- * Read temperature register from DS18B20 by ID.
+ * Read ds18b20 ROM ID (only sensor on the bus)
  *
- * @param obj 1-wire device object
- * @return Parsed value
+ * @param obj Sensor object; ID is stored into obj->id
+ * @return 0 on success, -ENODEV if no sensor answers or -EIO on bad CRC
  */
-struct ds18b20_temp ds18b20_read_temp_by_id(struct ds18b20 *obj, const uint8_t *id )
+int ds18b20_read_id(struct ds18b20 *obj)
 {
-	unsigned long flags;
-	int8_t data[9];
 	size_t i;
-    switch(ds_state) {
-        case DS18_CONVERTIN:
-
-            ow_reset_pulse(&ow);
-    	    ow_write_byte(&ow, OW_MATCH_ROM);
-            for(i = 0; i < 8; ++i)
-                ow_write_byte(&ow, (*(id + i)));
-
-            ow_write_byte(&ow, OW_READ_SCRATCHPAD);
-
-    	    for (i = 0; i < 9; i++)
-    	    	data[i] = ow_read_byte(&ow);
-
-            ow_reset_pulse(&ow);
-            // printf("CRC %s \n", check_crc(data[0])? "Ok" : "Nok" );
-    	    obj->temp = ds18b20_parse_temp(data[0], data[1]);
-            return obj->temp;
-        break;
-        default:
-            ds_state = DS18_SLEEP;
-            return obj->temp;
-        }
-}
 
+	if (ow_reset_pulse(&ow))
+		return -ENODEV;
+
+	ow_write_byte(&ow, OW_READ_ROM);
+	for (i = 0; i < 8; i++)
+		obj->id[i] = ow_read_byte(&ow);
+
+	if (ds18b20_crc8(obj->id, sizeof(obj->id)))
+		return -EIO;
+
+	return 0;
+}
 
 /**
  * Convert temperature data to null-terminated string.
@@ -269,17 +304,37 @@ char *ds18b20_temp2str(struct ds18b20_temp *obj, char str[])
 	return str;
 }
 
+/**
+ * Initialize sensor object and 1-wire bus.
+ *
+ * @param obj Sensor object: port, pin, match_id/id, cb and cb_data are set
+ *            by caller
+ * @return 0 on success or negative value on error
+ */
 int ds18b20_init(struct ds18b20 *obj)
 {
+	int ret;
+
 	ow.port = obj->port;
 	ow.pin = obj->pin;
 
-	return ow_init(&ow);
+	obj->state = DS18_SLEEP;
+	obj->timer_id = swtimer_tim_register(ds18b20_tick, obj,
+					     DS18B20_POLL_PERIOD);
+	if (obj->timer_id < 0)
+		return -ENOMEM;
+	swtimer_tim_stop(obj->timer_id);
+
+	ret = ow_init(&ow);
+	if (ret)
+		swtimer_tim_del(obj->timer_id);
+
+	return ret;
 }
 
 /* Destroy ds18b20 object */
 void ds18b20_exit(struct ds18b20 *obj)
 {
-	UNUSED(obj);
+	swtimer_tim_del(obj->timer_id);
 	ow_exit(&ow);
 }
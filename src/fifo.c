@@ -113,3 +113,9 @@ int32_t fifo_get(fifo_t *fifo, uint8_t *barr, uint32_t len)
 	return len;		// number of elements actually read
 }
 
+
+// Number of bytes currently stored in BFIFO
+fifo_len_t fifo_used(fifo_t *fifo)
+{
+	return fifo->buflen - _fifo_numleft(fifo);
+}
@@ -4,22 +4,38 @@
  * I2C controller driver.
  *
  * Features:
- *   - right now works only for transfer
- *   - only poll mode is implemented
+ *   - poll mode: synchronous *_poll() functions, spin on status flags
+ *   - interrupt mode: i2c_xfer_start() runs transfer described by
+ *     struct i2c_xfer from event/error interrupts and reports completion by
+ *     callback and/or waking up scheduler task
+ *   - DMA mode for long writes (I2C_XFER_DMA): data goes by DMA channel, CPU
+ *     only handles START, address and STOP
+ *
+ * Both modes share the driver state, so only one transfer at a time can run.
  */
 
 #include "../inc/i2c.h"
 #include "../inc/common.h"
+#include "../inc/irq.h"
+#include "../inc/sched.h"
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/dma.h>
 #include <libopencm3/stm32/i2c.h>
 #include <libopencm3/stm32/rcc.h>
 
 #include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include "libprintf/printf.h"
 /* Timeout values */
 #define I2C_TIMEOUT_FLAG    35	/* wait for generic flag, msec */
 #define I2C_TIMEOUT_BUSY	25	/* wait for BUSY flag, msec */
+/* Max loops to wait for STOP bit to be cleared in ISR (a few SCL periods) */
+#define I2C_STOP_SPIN		1000
+
+#define I2C_IT_ALL		(I2C_CR2_ITEVTEN | I2C_CR2_ITBUFEN | \
+				 I2C_CR2_ITERREN)
 
 /*
  * I2C states for driver internal usage.
@@ -74,10 +90,26 @@
 #define I2C_ERROR_DMA		BIT(4)	/* DMA transfer error */
 #define I2C_ERROR_TIMEOUT	BIT(5)	/* timeout error */
 
+/* Interrupt mode transfer phases */
+enum i2c_phase {
+	I2C_PHASE_TX,		/* sending reg and tx_buf */
+	I2C_PHASE_RX,		/* receiving into rx_buf */
+};
+
 struct i2c_t {
 	uint32_t base;		/* I2C register base address */
 	uint32_t state;		/* state of current I2C transaction */
 	uint32_t error;		/* errors happened during last transaction */
+	struct irq_action ev_action;
+	struct irq_action er_action;
+	struct i2c_xfer *xfer;	/* interrupt mode transfer in progress */
+	enum i2c_phase phase;
+	uint16_t idx;		/* bytes done in current phase */
+	uint16_t tx_total;	/* bytes to send in write phase */
+	bool addressed;		/* slave acked address in current phase */
+	bool dma_done;		/* DMA has fed the last byte into DR */
+	uint8_t dma_ch;		/* DMA1 channel of I2C TX */
+	struct irq_action dma_action;
 };
 
 static struct i2c_t i2c;
@@ -538,6 +570,401 @@ int i2c_detect_device(uint8_t addr)
 	return 0;
 }
 
+/* -------------------------------------------------------------------------- */
+
+/* Byte number "idx" of the write phase: reg goes before tx_buf */
+static uint8_t i2c_irq_tx_byte(const struct i2c_xfer *xfer, uint16_t idx)
+{
+	if (xfer->flags & I2C_XFER_REG) {
+		if (idx == 0)
+			return xfer->reg;
+		idx--;
+	}
+
+	return xfer->tx_buf[idx];
+}
+
+/* Finish interrupt mode transfer; called with interrupts disabled */
+static void i2c_irq_complete(int status)
+{
+	struct i2c_xfer *xfer = i2c.xfer;
+
+	i2c_disable_interrupt(i2c.base, I2C_IT_ALL);
+	if (xfer->flags & I2C_XFER_DMA) {
+		dma_disable_channel(DMA1, i2c.dma_ch);
+		i2c_disable_dma(i2c.base);
+	}
+	I2C_CR1(i2c.base) &= ~I2C_CR1_POS;
+	i2c_enable_ack(i2c.base);
+
+	i2c.xfer = NULL;
+	i2c.state = I2C_STATE_READY;
+	xfer->status = status;
+
+	/* Bus is free already, so callback can start next transfer */
+	if (xfer->cb)
+		xfer->cb(xfer, xfer->cb_data);
+	if (xfer->task_id)
+		sched_set_ready(xfer->task_id);
+}
+
+/* Switch to read phase: repeated START with read address goes next */
+static void i2c_irq_start_rx(void)
+{
+	i2c.phase = I2C_PHASE_RX;
+	i2c.idx = 0;
+	i2c.state = I2C_STATE_BUSY_RX;
+	i2c.addressed = false;
+	i2c_enable_ack(i2c.base);
+	i2c_enable_interrupt(i2c.base, I2C_CR2_ITBUFEN);
+	i2c_send_start(i2c.base);
+}
+
+/* ADDR event (EV6): slave acknowledged its address */
+static void i2c_irq_addr(struct i2c_xfer *xfer)
+{
+	uint32_t base = i2c.base;
+
+	i2c.addressed = true;
+
+	if (i2c.phase == I2C_PHASE_TX) {
+		(void)I2C_SR2(base); /* clear ADDR */
+		if (xfer->flags & I2C_XFER_DMA) {
+			/* Control byte by CPU, then DMA serves TxE requests */
+			if (xfer->flags & I2C_XFER_REG)
+				i2c_send_data(base, xfer->reg);
+			i2c_enable_dma(base);
+			dma_enable_channel(DMA1, i2c.dma_ch);
+			return;
+		}
+		/* Address only transfer, i.e. device detection */
+		if (i2c.tx_total == 0 && xfer->rx_len == 0) {
+			i2c_send_stop(base);
+			i2c_irq_complete(0);
+		}
+		return;
+	}
+
+	/* Reception end is prepared in advance: EV6_1 / EV6_3 */
+	switch (xfer->rx_len) {
+	case 1:
+		i2c_disable_ack(base);
+		(void)I2C_SR2(base);
+		i2c_send_stop(base);
+		break;
+	case 2:
+		i2c_disable_ack(base);
+		I2C_CR1(base) |= I2C_CR1_POS;
+		(void)I2C_SR2(base);
+		/* Both bytes are taken on BTF */
+		i2c_disable_interrupt(base, I2C_CR2_ITBUFEN);
+		break;
+	default:
+		(void)I2C_SR2(base);
+		if (xfer->rx_len == 3)
+			i2c_disable_interrupt(base, I2C_CR2_ITBUFEN);
+		break;
+	}
+}
+
+/* Write phase events: TxE (EV8) and BTF (EV8_2) */
+static void i2c_irq_tx(struct i2c_xfer *xfer, uint16_t sr1)
+{
+	uint32_t base = i2c.base;
+
+	if (xfer->flags & I2C_XFER_DMA) {
+		/*
+		 * BTF can show up while DMA is late with the next byte; STOP
+		 * only goes after DMA is done and the last byte has left the
+		 * shift register (BTF), otherwise it's lost (see errata).
+		 */
+		if (i2c.dma_done && (sr1 & I2C_SR1_BTF)) {
+			i2c_send_stop(base);
+			i2c_irq_complete(0);
+		}
+		return;
+	}
+
+	if (i2c.idx < i2c.tx_total) {
+		if (sr1 & (I2C_SR1_TxE | I2C_SR1_BTF))
+			i2c_send_data(base, i2c_irq_tx_byte(xfer, i2c.idx++));
+		/* Last byte is in DR: wait for BTF only */
+		if (i2c.idx == i2c.tx_total)
+			i2c_disable_interrupt(base, I2C_CR2_ITBUFEN);
+		return;
+	}
+
+	if (!(sr1 & I2C_SR1_BTF))
+		return;
+
+	if (xfer->rx_len) {
+		i2c_irq_start_rx();
+	} else {
+		i2c_send_stop(base);
+		i2c_irq_complete(0);
+	}
+}
+
+/* Read phase events: RxNE (EV7) and BTF; see AN2824 for N = 1, 2, > 2 */
+static void i2c_irq_rx(struct i2c_xfer *xfer, uint16_t sr1)
+{
+	uint32_t base = i2c.base;
+	uint16_t left = xfer->rx_len - i2c.idx;
+
+	if (xfer->rx_len == 1) {
+		if (sr1 & I2C_SR1_RxNE) {
+			xfer->rx_buf[i2c.idx++] = i2c_get_data(base);
+			i2c_irq_complete(0);
+		}
+		return;
+	}
+
+	if (left > 3) {
+		if (sr1 & I2C_SR1_RxNE) {
+			xfer->rx_buf[i2c.idx++] = i2c_get_data(base);
+			/* Last 3 bytes are handled on BTF (EV7_2) */
+			if (left - 1 == 3)
+				i2c_disable_interrupt(base, I2C_CR2_ITBUFEN);
+		}
+		return;
+	}
+
+	if (!(sr1 & I2C_SR1_BTF))
+		return;
+
+	if (left == 3) {
+		/* DR = byte N-2, shift register = byte N-1: NACK byte N */
+		i2c_disable_ack(base);
+		xfer->rx_buf[i2c.idx++] = i2c_get_data(base);
+	} else {
+		/* DR = byte N-1, shift register = byte N */
+		i2c_send_stop(base);
+		xfer->rx_buf[i2c.idx++] = i2c_get_data(base);
+		xfer->rx_buf[i2c.idx++] = i2c_get_data(base);
+		i2c_irq_complete(0);
+	}
+}
+
+static irqreturn_t i2c_ev_isr(int irq, void *data)
+{
+	struct i2c_xfer *xfer = i2c.xfer;
+	uint32_t base = i2c.base;
+	uint16_t sr1;
+
+	UNUSED(irq);
+	UNUSED(data);
+
+	if (!xfer) {
+		i2c_disable_interrupt(base, I2C_IT_ALL);
+		return IRQ_NONE;
+	}
+
+	sr1 = I2C_SR1(base);
+
+	if (sr1 & I2C_SR1_SB) {
+		i2c_send_7bit_address(base, xfer->addr,
+				      i2c.phase == I2C_PHASE_RX ?
+				      I2C_READ : I2C_WRITE);
+	} else if (sr1 & I2C_SR1_ADDR) {
+		i2c_irq_addr(xfer);
+	} else if (!i2c.addressed) {
+		/* BTF of write phase stays set until repeated START is out */
+	} else if (i2c.phase == I2C_PHASE_TX) {
+		i2c_irq_tx(xfer, sr1);
+	} else {
+		i2c_irq_rx(xfer, sr1);
+	}
+
+	return IRQ_HANDLED;
+}
+
+static irqreturn_t i2c_er_isr(int irq, void *data)
+{
+	uint32_t base = i2c.base;
+	uint16_t sr1 = I2C_SR1(base);
+	uint32_t error = I2C_ERROR_NONE;
+
+	UNUSED(irq);
+	UNUSED(data);
+
+	if (sr1 & I2C_SR1_BERR)
+		error |= I2C_ERROR_BERR;
+	if (sr1 & I2C_SR1_ARLO)
+		error |= I2C_ERROR_ARLO;
+	if (sr1 & I2C_SR1_AF)
+		error |= I2C_ERROR_AF;
+	if (sr1 & I2C_SR1_OVR)
+		error |= I2C_ERROR_OVR;
+
+	/* Error flags are cleared by writing 0 */
+	I2C_SR1(base) = ~(I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF |
+			  I2C_SR1_OVR);
+
+	if (!i2c.xfer) {
+		i2c_disable_interrupt(base, I2C_IT_ALL);
+		return IRQ_NONE;
+	}
+
+	/* Master has lost the bus on arbitration loss: no STOP then */
+	if (!(error & I2C_ERROR_ARLO))
+		i2c_send_stop(base);
+
+	i2c.error = error;
+	i2c_irq_complete(-EIO);
+
+	return IRQ_HANDLED;
+}
+
+/* DMA TX channel: all bytes are in I2C, wait for BTF to send STOP */
+static irqreturn_t i2c_dma_isr(int irq, void *data)
+{
+	UNUSED(irq);
+	UNUSED(data);
+
+	if (dma_get_interrupt_flag(DMA1, i2c.dma_ch, DMA_TEIF)) {
+		dma_clear_interrupt_flags(DMA1, i2c.dma_ch, DMA_TEIF);
+		if (i2c.xfer) {
+			i2c_send_stop(i2c.base);
+			i2c.error = I2C_ERROR_DMA;
+			i2c_irq_complete(-EIO);
+		}
+		return IRQ_HANDLED;
+	}
+
+	dma_clear_interrupt_flags(DMA1, i2c.dma_ch, DMA_TCIF | DMA_GIF);
+	dma_disable_channel(DMA1, i2c.dma_ch);
+	i2c_disable_dma(i2c.base);
+	i2c.dma_done = true;
+
+	return IRQ_HANDLED;
+}
+
+/* Program DMA channel for write phase; channel is enabled on ADDR */
+static void i2c_dma_setup(const struct i2c_xfer *xfer)
+{
+	uint8_t ch = i2c.dma_ch;
+
+	dma_channel_reset(DMA1, ch);
+	dma_set_peripheral_address(DMA1, ch, (uint32_t)&I2C_DR(i2c.base));
+	dma_set_memory_address(DMA1, ch, (uint32_t)xfer->tx_buf);
+	dma_set_number_of_data(DMA1, ch, xfer->tx_len);
+	dma_set_read_from_memory(DMA1, ch);
+	dma_enable_memory_increment_mode(DMA1, ch);
+	dma_set_peripheral_size(DMA1, ch, DMA_CCR_PSIZE_8BIT);
+	dma_set_memory_size(DMA1, ch, DMA_CCR_MSIZE_8BIT);
+	dma_set_priority(DMA1, ch, DMA_CCR_PL_HIGH);
+	dma_enable_transfer_complete_interrupt(DMA1, ch);
+	dma_enable_transfer_error_interrupt(DMA1, ch);
+}
+
+/**
+ * Start interrupt-driven I2C transfer.
+ *
+ * Function returns immediately; transfer goes on in I2C interrupts. When it
+ * is finished, xfer->status is set, xfer->cb is called (from ISR) and
+ * xfer->task_id task is woken up. Can be called from ISR (e.g. from the
+ * completion callback of previous transfer).
+ *
+ * Possible errors:
+ *   -EBUSY: another I2C transaction is not finished
+ *   -EINVAL: empty read phase buffer or DMA asked for a read/empty transfer
+ *
+ * @param xfer Transfer descriptor
+ * @return 0 if transfer is started or negative value on error
+ */
+int i2c_xfer_start(struct i2c_xfer *xfer)
+{
+	unsigned long flags;
+	uint32_t base = i2c.base;
+	int spin = I2C_STOP_SPIN;
+
+	if (xfer->rx_len && !xfer->rx_buf)
+		return -EINVAL;
+	if ((xfer->flags & I2C_XFER_DMA) && (xfer->rx_len || !xfer->tx_len))
+		return -EINVAL;
+
+	enter_critical(flags);
+	if (i2c.state != I2C_STATE_READY) {
+		exit_critical(flags);
+		return -EBUSY;
+	}
+
+	/* STOP of previous transfer may still be on the bus */
+	while ((I2C_CR1(base) & I2C_CR1_STOP) && --spin)
+		;
+	if (!spin) {
+		exit_critical(flags);
+		return -EBUSY;
+	}
+
+	i2c.xfer = xfer;
+	i2c.error = I2C_ERROR_NONE;
+	i2c.idx = 0;
+	i2c.addressed = false;
+	i2c.tx_total = xfer->tx_len + ((xfer->flags & I2C_XFER_REG) ? 1 : 0);
+	xfer->status = -EINPROGRESS;
+
+	if (i2c.tx_total == 0 && xfer->rx_len) {
+		i2c.phase = I2C_PHASE_RX;
+		i2c.state = I2C_STATE_BUSY_RX;
+	} else {
+		i2c.phase = I2C_PHASE_TX;
+		i2c.state = I2C_STATE_BUSY_TX;
+	}
+
+	i2c_enable_ack(base);
+	if (xfer->flags & I2C_XFER_DMA) {
+		/* Only SB, ADDR and final BTF are handled by CPU */
+		i2c.dma_done = false;
+		i2c_dma_setup(xfer);
+		i2c_enable_interrupt(base, I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+	} else {
+		i2c_enable_interrupt(base, I2C_IT_ALL);
+	}
+	i2c_send_start(base);
+	exit_critical(flags);
+
+	return 0;
+}
+
+/**
+ * Abort interrupt mode transfer in progress (e.g. on timeout).
+ *
+ * Transfer is completed with -ETIMEDOUT status.
+ */
+void i2c_xfer_abort(void)
+{
+	unsigned long flags;
+
+	enter_critical(flags);
+	if (i2c.xfer) {
+		i2c_send_stop(i2c.base);
+		i2c.error = I2C_ERROR_TIMEOUT;
+		i2c_irq_complete(-ETIMEDOUT);
+	}
+	exit_critical(flags);
+}
+
+/**
+ * Wait for interrupt mode transfer to finish.
+ *
+ * Fallback for callers which can't go on without the result (e.g. device
+ * initialization); the CPU spins, but interrupts are served meanwhile.
+ *
+ * @param xfer Transfer started by i2c_xfer_start()
+ * @param timeout Timeout, msec; transfer is aborted when it expires
+ * @return Transfer status: 0 on success or negative value on error
+ */
+int i2c_xfer_wait(struct i2c_xfer *xfer, uint32_t timeout)
+{
+	if (wait_event_timeout(READ_ONCE(xfer->status) != -EINPROGRESS,
+			       timeout)) {
+		i2c_xfer_abort();
+	}
+
+	return READ_ONCE(xfer->status);
+}
+
 /**
  * Initialize I2C module.
  *
@@ -545,11 +972,48 @@ int i2c_detect_device(uint8_t addr)
  */
 int i2c_init(uint32_t base)
 {
+	int ret;
+
 	i2c_setup(base);
 
 	i2c.base = base;
 	i2c.state = I2C_STATE_READY;
 	i2c.error = I2C_ERROR_NONE;
+	i2c.xfer = NULL;
+
+	i2c.ev_action.handler = i2c_ev_isr;
+	i2c.ev_action.irq = base == I2C1 ? NVIC_I2C1_EV_IRQ : NVIC_I2C2_EV_IRQ;
+	i2c.ev_action.name = "i2c_ev";
+	ret = irq_request(&i2c.ev_action);
+	if (ret)
+		return ret;
+
+	i2c.er_action.handler = i2c_er_isr;
+	i2c.er_action.irq = base == I2C1 ? NVIC_I2C1_ER_IRQ : NVIC_I2C2_ER_IRQ;
+	i2c.er_action.name = "i2c_er";
+	ret = irq_request(&i2c.er_action);
+	if (ret) {
+		irq_free(&i2c.ev_action);
+		return ret;
+	}
+
+	/* TX DMA request: I2C1 - DMA1 channel 6, I2C2 - DMA1 channel 4 */
+	i2c.dma_ch = base == I2C1 ? DMA_CHANNEL6 : DMA_CHANNEL4;
+	i2c.dma_action.handler = i2c_dma_isr;
+	i2c.dma_action.irq = base == I2C1 ? NVIC_DMA1_CHANNEL6_IRQ :
+					    NVIC_DMA1_CHANNEL4_IRQ;
+	i2c.dma_action.name = "i2c_dma";
+	ret = irq_request(&i2c.dma_action);
+	if (ret) {
+		irq_free(&i2c.er_action);
+		irq_free(&i2c.ev_action);
+		return ret;
+	}
+
+	/* Nothing fires until i2c_xfer_start() enables interrupts in CR2 */
+	nvic_enable_irq(i2c.ev_action.irq);
+	nvic_enable_irq(i2c.er_action.irq);
+	nvic_enable_irq(i2c.dma_action.irq);
 
 	return 0;
 }
@@ -0,0 +1,281 @@
+/**
+ * @file
+ *
+ * I2C transaction queue: lets several device drivers share one I2C bus.
+ *
+ * Clients submit transactions and get completion callbacks (or task wake
+ * up). Transactions run back-to-back: the next one is started right from
+ * the completion interrupt of the previous one, so the bus doesn't idle
+ * waiting for the scheduler. Each priority has its own FIFO list and the
+ * highest priority non-empty list goes first; long writes may be split into
+ * chunks, so e.g. a sensor read waits for one display chunk at most instead
+ * of the whole frame.
+ *
+ * Software timer restarts the queue if the bus was taken by polling API
+ * meanwhile, and aborts hung transfers.
+ */
+
+#include "../inc/i2c_queue.h"
+#include "../inc/i2c.h"
+#include "../inc/common.h"
+#include "../inc/sched.h"
+#include "../inc/swtimer.h"
+#include "../inc/systick.h"
+
+#include <errno.h>
+#include <stddef.h>
+
+#define I2C_QUEUE_TICK		10	/* restart/timeout check period, msec */
+#define I2C_QUEUE_TIMEOUT	50	/* max time of one bus transfer, msec */
+
+struct i2c_queue {
+	struct i2c_txn *head[I2C_PRIO_NR];
+	struct i2c_txn *tail[I2C_PRIO_NR];
+	struct i2c_txn *cur;		/* transaction on the bus */
+	struct i2c_xfer xfer;		/* bus transfer of cur */
+	uint32_t t_start;		/* msec, bus transfer started */
+	int tim_id;
+};
+
+static struct i2c_queue i2cq;
+
+static void i2c_queue_xfer_done(struct i2c_xfer *xfer, void *data);
+
+/* Highest priority waiting transaction, or NULL */
+static struct i2c_txn *i2c_queue_peek(struct i2c_queue *obj)
+{
+	int i;
+
+	for (i = 0; i < I2C_PRIO_NR; ++i) {
+		if (obj->head[i])
+			return obj->head[i];
+	}
+
+	return NULL;
+}
+
+static void i2c_queue_remove(struct i2c_queue *obj, struct i2c_txn *txn)
+{
+	obj->head[txn->prio] = txn->next;
+	if (!txn->next)
+		obj->tail[txn->prio] = NULL;
+	txn->next = NULL;
+}
+
+/* Start next bus transfer; called with interrupts disabled */
+static void i2c_queue_kick(struct i2c_queue *obj)
+{
+	struct i2c_txn *txn;
+	uint16_t left;
+	int ret;
+
+	if (obj->cur)
+		return;
+
+	txn = i2c_queue_peek(obj);
+	if (!txn)
+		return;
+
+	left = txn->tx_len - txn->done;
+
+	obj->xfer.addr = txn->addr;
+	obj->xfer.flags = txn->flags;
+	obj->xfer.reg = txn->reg;
+	obj->xfer.tx_buf = txn->tx_buf + txn->done;
+	obj->xfer.tx_len = left;
+	obj->xfer.rx_buf = txn->rx_buf;
+	obj->xfer.rx_len = txn->rx_len;
+	obj->xfer.cb = i2c_queue_xfer_done;
+	obj->xfer.cb_data = obj;
+	obj->xfer.task_id = 0;
+
+	/* Read phase goes with the last chunk only */
+	if (txn->chunk && left > txn->chunk) {
+		obj->xfer.tx_len = txn->chunk;
+		obj->xfer.rx_len = 0;
+	}
+
+	obj->cur = txn;
+	obj->t_start = systick_get_time_ms();
+	ret = i2c_xfer_start(&obj->xfer);
+	if (ret == -EBUSY) {
+		/* Bus is taken by polling API; timer tick will retry */
+		obj->cur = NULL;
+	} else if (ret != 0) {
+		obj->cur = NULL;
+		i2c_queue_remove(obj, txn);
+		txn->status = ret;
+		if (txn->cb)
+			txn->cb(txn, txn->cb_data);
+		if (txn->task_id)
+			sched_set_ready(txn->task_id);
+		i2c_queue_kick(obj);
+	}
+}
+
+/* Bus transfer finished (called from ISR) */
+static void i2c_queue_xfer_done(struct i2c_xfer *xfer, void *data)
+{
+	struct i2c_queue *obj = data;
+	struct i2c_txn *txn = obj->cur;
+
+	obj->cur = NULL;
+	txn->done += xfer->tx_len;
+
+	/* More chunks to go: stay in the list, higher priority may go first */
+	if (xfer->status == 0 && txn->done < txn->tx_len) {
+		i2c_queue_kick(obj);
+		return;
+	}
+
+	i2c_queue_remove(obj, txn);
+	txn->status = xfer->status;
+	if (txn->cb)
+		txn->cb(txn, txn->cb_data);
+	if (txn->task_id)
+		sched_set_ready(txn->task_id);
+
+	i2c_queue_kick(obj);
+}
+
+/* Restart stalled queue and abort hung transfer */
+static void i2c_queue_tick(void *data)
+{
+	struct i2c_queue *obj = data;
+	unsigned long flags;
+
+	enter_critical(flags);
+	if (!obj->cur) {
+		i2c_queue_kick(obj);
+	} else if (systick_calc_diff_ms(obj->t_start, systick_get_time_ms()) >
+		   I2C_QUEUE_TIMEOUT) {
+		/* Completes the transfer with -ETIMEDOUT and kicks the queue */
+		i2c_xfer_abort();
+	}
+	exit_critical(flags);
+}
+
+/**
+ * Submit I2C transaction.
+ *
+ * Can be called from ISR (e.g. from completion callback).
+ *
+ * @param txn Transaction; completion is reported by txn->cb / txn->task_id
+ * @return 0 if transaction is queued or negative value on error
+ */
+int i2c_queue_submit(struct i2c_txn *txn)
+{
+	struct i2c_queue *obj = &i2cq;
+	unsigned long flags;
+
+	if (txn->prio >= I2C_PRIO_NR)
+		return -EINVAL;
+	if (txn->rx_len && !txn->rx_buf)
+		return -EINVAL;
+	if ((txn->flags & I2C_XFER_DMA) && txn->rx_len)
+		return -EINVAL;
+
+	enter_critical(flags);
+	if (txn->status == -EINPROGRESS) {
+		exit_critical(flags);
+		return -EBUSY;
+	}
+
+	txn->status = -EINPROGRESS;
+	txn->done = 0;
+	txn->next = NULL;
+	if (obj->tail[txn->prio])
+		obj->tail[txn->prio]->next = txn;
+	else
+		obj->head[txn->prio] = txn;
+	obj->tail[txn->prio] = txn;
+
+	i2c_queue_kick(obj);
+	exit_critical(flags);
+
+	return 0;
+}
+
+/* Take transaction out of the queue (or abort it), finish with -ETIMEDOUT */
+static void i2c_queue_cancel(struct i2c_queue *obj, struct i2c_txn *txn)
+{
+	struct i2c_txn *prev = NULL, *cur;
+	unsigned long flags;
+
+	enter_critical(flags);
+	if (txn->status != -EINPROGRESS)
+		goto out;
+
+	if (obj->cur == txn) {
+		i2c_xfer_abort();
+		goto out;
+	}
+
+	for (cur = obj->head[txn->prio]; cur; prev = cur, cur = cur->next) {
+		if (cur != txn)
+			continue;
+		if (prev)
+			prev->next = txn->next;
+		else
+			obj->head[txn->prio] = txn->next;
+		if (obj->tail[txn->prio] == txn)
+			obj->tail[txn->prio] = prev;
+		break;
+	}
+	txn->next = NULL;
+	txn->status = -ETIMEDOUT;
+
+out:
+	exit_critical(flags);
+}
+
+/**
+ * Wait for submitted transaction to finish.
+ *
+ * Blocking fallback for callers which can't go on without the result.
+ * Transaction is cancelled on timeout, so its buffers are free on return.
+ *
+ * @param txn Submitted transaction
+ * @param timeout Timeout, msec
+ * @return Transaction status: 0 on success or negative value on error
+ */
+int i2c_queue_wait(struct i2c_txn *txn, uint32_t timeout)
+{
+	if (wait_event_timeout(READ_ONCE(txn->status) != -EINPROGRESS,
+			       timeout)) {
+		i2c_queue_cancel(&i2cq, txn);
+	}
+
+	return READ_ONCE(txn->status);
+}
+
+/**
+ * Initialize I2C transaction queue.
+ *
+ * I2C driver must be initialized before submitting transactions.
+ *
+ * @return 0 on success or negative value on error
+ */
+int i2c_queue_init(void)
+{
+	struct i2c_queue *obj = &i2cq;
+	int i;
+
+	for (i = 0; i < I2C_PRIO_NR; ++i) {
+		obj->head[i] = NULL;
+		obj->tail[i] = NULL;
+	}
+	obj->cur = NULL;
+
+	obj->tim_id = swtimer_tim_register(i2c_queue_tick, obj,
+					   I2C_QUEUE_TICK);
+	if (obj->tim_id < 0)
+		return -ENOMEM;
+
+	return 0;
+}
+
+void i2c_queue_exit(void)
+{
+	swtimer_tim_del(i2cq.tim_id);
+}
@@ -0,0 +1,427 @@
+/**
+ * @file
+ *
+ * Modbus RTU bus master for many SenseAir S8 sensors on one RS-485 bus.
+ *
+ * Slaves from the configured address table are polled round-robin; each slave
+ * is polled for one full S8 poll cycle (see s8.c), then the next slave goes.
+ * The driver is event driven and never waits on the bus:
+ *   - serial TX complete interrupt releases RS-485 driver (DE pin) and starts
+ *     reply timeout;
+ *   - serial RX interrupt counts reply bytes and wakes the scheduler task once
+ *     the whole reply is in RX FIFO;
+ *   - the task validates the reply and sends the next request right after the
+ *     inter-frame gap (3.5 characters), so the bus stays busy back-to-back;
+ *   - periodic software timer catches timeouts and ends slave backoffs.
+ *
+ * Failed request is retried; when retries are exhausted the slave is put into
+ * exponential backoff, so a dead sensor doesn't eat bus time of alive ones.
+ */
+
+#include "modbus_master.h"
+#include "modbus.h"
+#include "serial.h"
+#include "sched.h"
+#include "swtimer.h"
+#include "systick.h"
+#include "common.h"
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#define MODBUS_MASTER_TASK	"modbus_master"
+#define MODBUS_MASTER_TICK	10	/* timeouts check period, msec */
+#define MODBUS_MASTER_AVG_N	8	/* latency average weight: 1 / N */
+#define MODBUS_MASTER_RATE_WIN	1000	/* samples rate window, msec */
+#define MODBUS_MASTER_RESP_MAX	MODBUS_READ_RESP_LEN(S8_BATCH_REGS_MAX)
+
+enum modbus_master_state {
+	MODBUS_MASTER_IDLE,	/* bus is free */
+	MODBUS_MASTER_TX,	/* request is being sent */
+	MODBUS_MASTER_WAIT,	/* waiting for reply */
+	MODBUS_MASTER_DONE,	/* reply is received, not handled yet */
+};
+
+struct modbus_slave {
+	uint8_t addr;
+	uint8_t tries;		/* failed tries of current request */
+	uint8_t fails;		/* consecutive backoffs; 0 - slave is alive */
+	uint32_t backoff_until;	/* msec; slave is skipped until then */
+	struct s8_poller poller;
+	struct s8_sample sample;	/* being collected */
+	struct s8_sample last;		/* last complete sample */
+	struct modbus_slave_stats stats;
+};
+
+struct modbus_master {
+	struct modbus_master_cfg cfg;
+	struct modbus_slave slaves[MODBUS_MASTER_SLAVES_MAX];
+	int cur;			/* index of slave being polled */
+	const struct s8_batch *batch;	/* transaction in progress */
+	volatile int state;		/* enum modbus_master_state */
+	volatile uint16_t rx_len;	/* reply bytes received */
+	volatile uint16_t rx_expect;	/* reply length expected */
+	volatile uint32_t t_sent;	/* usec, request left the line */
+	volatile uint32_t t_rx;		/* usec, last reply byte received */
+	volatile uint32_t t_start;	/* msec, for timeout */
+	uint32_t gap;			/* inter-frame gap, usec */
+	uint8_t frame[MODBUS_MASTER_RESP_MAX];
+	int task_id;
+	int tim_id;
+	uint32_t rate_t;		/* msec, rate window start */
+	uint32_t rate_samples;		/* samples in current window */
+	uint32_t rate;			/* samples per second */
+};
+
+static struct modbus_master mbm;
+
+/* Drop everything in RX FIFO */
+static void modbus_master_flush_rx(struct modbus_master *obj)
+{
+	while (serial_receive_fifo(obj->cfg.usart, obj->frame,
+				   sizeof(obj->frame)) > 0)
+		;
+}
+
+/* Poll cycle of the slave is over: make the sample visible */
+static void modbus_master_publish(struct modbus_master *obj, int idx)
+{
+	struct modbus_slave *slave = &obj->slaves[idx];
+	unsigned long flags;
+
+	if (!slave->sample.valid)
+		return;
+
+	slave->sample.timestamp = systick_get_time_ms();
+	enter_critical(flags);
+	slave->last = slave->sample;
+	exit_critical(flags);
+
+	slave->sample.valid = 0;
+	slave->stats.samples++;
+	obj->rate_samples++;
+
+	if (obj->cfg.cb)
+		obj->cfg.cb(idx, slave->addr, &slave->last, obj->cfg.cb_data);
+}
+
+/* Find next transaction to run: current slave first, then round-robin */
+static const struct s8_batch *modbus_master_pick(struct modbus_master *obj)
+{
+	uint32_t now = systick_get_time_ms();
+	int n;
+
+	/* +1: current slave may end its cycle and get its turn again */
+	for (n = 0; n <= obj->cfg.slave_nr; ++n) {
+		struct modbus_slave *slave = &obj->slaves[obj->cur];
+
+		if (!slave->fails || (int32_t)(now - slave->backoff_until) >= 0) {
+			const struct s8_batch *b;
+
+			b = s8_next_batch(&slave->poller);
+			if (b)
+				return b;
+			modbus_master_publish(obj, obj->cur);
+		}
+
+		obj->cur = (obj->cur + 1) % obj->cfg.slave_nr;
+	}
+
+	return NULL;
+}
+
+static void modbus_master_send(struct modbus_master *obj)
+{
+	struct modbus_slave *slave = &obj->slaves[obj->cur];
+	uint8_t req[MODBUS_READ_REQ_LEN];
+
+	modbus_build_read(req, slave->addr, obj->batch->fc, obj->batch->start,
+			  obj->batch->count);
+	modbus_master_flush_rx(obj);
+
+	obj->rx_len = 0;
+	obj->rx_expect = MODBUS_READ_RESP_LEN(obj->batch->count);
+	obj->t_start = systick_get_time_ms();
+	WRITE_ONCE(obj->state, MODBUS_MASTER_TX);
+	slave->stats.requests++;
+
+	if (serial_send_fifo(obj->cfg.usart, req, MODBUS_READ_REQ_LEN) < 0)
+		WRITE_ONCE(obj->state, MODBUS_MASTER_IDLE);	/* retry later */
+}
+
+/* Transaction failed: retry it or put slave into backoff */
+static void modbus_master_fail(struct modbus_master *obj)
+{
+	struct modbus_slave *slave = &obj->slaves[obj->cur];
+	uint32_t backoff;
+
+	WRITE_ONCE(obj->state, MODBUS_MASTER_IDLE);
+	obj->t_rx = systick_get_time_us();
+
+	if (++slave->tries <= obj->cfg.retries)
+		return;			/* obj->batch is kept: send it again */
+
+	slave->tries = 0;
+	if (slave->fails < 16)
+		slave->fails++;
+	backoff = (uint32_t)obj->cfg.timeout << slave->fails;
+	if (backoff > obj->cfg.backoff_max)
+		backoff = obj->cfg.backoff_max;
+	slave->backoff_until = systick_get_time_ms() + backoff;
+
+	/* Abandon the poll cycle; partial sample is dropped */
+	while (s8_next_batch(&slave->poller))
+		;
+	slave->sample.valid = 0;
+	obj->batch = NULL;
+	obj->cur = (obj->cur + 1) % obj->cfg.slave_nr;
+}
+
+/* Reply is in RX FIFO: validate and decode it */
+static void modbus_master_finish(struct modbus_master *obj)
+{
+	struct modbus_slave *slave = &obj->slaves[obj->cur];
+	struct modbus_slave_stats *st = &slave->stats;
+	uint32_t latency;
+	int len, ret;
+
+	len = serial_receive_fifo(obj->cfg.usart, obj->frame, obj->rx_expect);
+	if (len < 0)
+		len = 0;
+
+	ret = modbus_check_read_resp(obj->frame, len, slave->addr,
+				     obj->batch->fc, obj->batch->count);
+	if (ret == -EPROTO) {
+		st->exceptions++;
+		modbus_master_fail(obj);
+		return;
+	} else if (ret != 0) {
+		st->bad_frames++;
+		modbus_master_fail(obj);
+		return;
+	}
+
+	latency = obj->t_rx - obj->t_sent;
+	st->replies++;
+	st->latency_last = latency;
+	if (st->replies == 1)
+		st->latency_avg = latency;
+	else
+		st->latency_avg += (int32_t)(latency - st->latency_avg) /
+				   MODBUS_MASTER_AVG_N;
+	if (!st->latency_min || latency < st->latency_min)
+		st->latency_min = latency;
+	if (latency > st->latency_max)
+		st->latency_max = latency;
+
+	s8_decode(obj->batch, &obj->frame[3], &slave->sample);
+	slave->tries = 0;
+	slave->fails = 0;
+	obj->batch = NULL;
+	WRITE_ONCE(obj->state, MODBUS_MASTER_IDLE);
+}
+
+static void modbus_master_task(void *data)
+{
+	struct modbus_master *obj = (struct modbus_master *)data;
+	int state = READ_ONCE(obj->state);
+
+	if (state == MODBUS_MASTER_DONE) {
+		modbus_master_finish(obj);
+	} else if (state != MODBUS_MASTER_IDLE) {
+		uint32_t elapsed = systick_calc_diff_ms(obj->t_start,
+							systick_get_time_ms());
+
+		if (elapsed <= obj->cfg.timeout)
+			return;
+		obj->slaves[obj->cur].stats.timeouts++;
+		modbus_master_fail(obj);
+	}
+
+	/*
+	 * Keep the inter-frame silence before the next request. It's short,
+	 * so just stay ready and let the other tasks run in the meantime.
+	 */
+	if (systick_get_time_us() - obj->t_rx < obj->gap) {
+		sched_set_ready(obj->task_id);
+		return;
+	}
+
+	if (!obj->batch)
+		obj->batch = modbus_master_pick(obj);
+	if (obj->batch)
+		modbus_master_send(obj);
+}
+
+static void modbus_master_tick(void *data)
+{
+	struct modbus_master *obj = (struct modbus_master *)data;
+	uint32_t now = systick_get_time_ms();
+	uint32_t elapsed = systick_calc_diff_ms(obj->rate_t, now);
+
+	if (elapsed >= MODBUS_MASTER_RATE_WIN) {
+		obj->rate = obj->rate_samples * 1000 / elapsed;
+		obj->rate_samples = 0;
+		obj->rate_t = now;
+	}
+
+	sched_set_ready(obj->task_id);
+}
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ * Serial RX callback; pass it as "rx_cb" of the bus serial port.
+ *
+ * Runs in ISR context.
+ */
+void modbus_master_rx(uint8_t byte, void *data)
+{
+	struct modbus_master *obj = &mbm;
+
+	UNUSED(data);
+
+	if (obj->state != MODBUS_MASTER_WAIT)
+		return;
+
+	obj->t_rx = systick_get_time_us();
+	obj->rx_len++;
+	if (obj->rx_len == 2 && (byte & MODBUS_FC_EXCEPTION))
+		obj->rx_expect = MODBUS_EXCEPTION_LEN;
+	if (obj->rx_len >= obj->rx_expect) {
+		obj->state = MODBUS_MASTER_DONE;
+		sched_set_ready(obj->task_id);
+	}
+}
+
+/**
+ * Serial TX complete callback; pass it as "tc_cb" of the bus serial port.
+ *
+ * Runs in ISR context, right after RS-485 driver is released.
+ */
+void modbus_master_tc(void *data)
+{
+	struct modbus_master *obj = &mbm;
+
+	UNUSED(data);
+
+	if (obj->state != MODBUS_MASTER_TX)
+		return;
+
+	obj->t_sent = systick_get_time_us();
+	obj->t_start = systick_get_time_ms();
+	obj->state = MODBUS_MASTER_WAIT;
+}
+
+/**
+ * Get last complete sample of the slave.
+ *
+ * @param idx Slave index in addresses table
+ * @param[out] sample Last sample; its "valid" mask is 0 if no sample yet
+ * @return 0 on success or negative value on error
+ */
+int modbus_master_get_sample(int idx, struct s8_sample *sample)
+{
+	unsigned long flags;
+
+	if (idx < 0 || idx >= mbm.cfg.slave_nr)
+		return -EINVAL;
+
+	enter_critical(flags);
+	*sample = mbm.slaves[idx].last;
+	exit_critical(flags);
+
+	return 0;
+}
+
+/**
+ * Get statistics of the slave.
+ *
+ * @param idx Slave index in addresses table
+ * @param[out] stats Statistics snapshot
+ * @return 0 on success or negative value on error
+ */
+int modbus_master_get_stats(int idx, struct modbus_slave_stats *stats)
+{
+	unsigned long flags;
+
+	if (idx < 0 || idx >= mbm.cfg.slave_nr)
+		return -EINVAL;
+
+	enter_critical(flags);
+	*stats = mbm.slaves[idx].stats;
+	exit_critical(flags);
+
+	return 0;
+}
+
+/**
+ * Get aggregate samples rate of the bus (all slaves).
+ *
+ * @return Complete samples per second, over the last second
+ */
+uint32_t modbus_master_get_rate(void)
+{
+	return mbm.rate;
+}
+
+/**
+ * Initialize bus master and start polling.
+ *
+ * Serial port must be initialized with @ref modbus_master_rx() and
+ * @ref modbus_master_tc() callbacks, and with RS-485 DE pin if used.
+ * Use MODBUS_ADDR_ANY only when there is a single sensor on the bus.
+ *
+ * @param cfg Bus configuration; addresses table must stay valid
+ * @return 0 on success or negative value on error
+ *
+ * @note s8_init(), scheduler and swtimer must be initialized before
+ */
+int modbus_master_init(const struct modbus_master_cfg *cfg)
+{
+	struct modbus_master *obj = &mbm;
+	size_t i;
+	int ret;
+
+	if (cfg->slave_nr == 0 || cfg->slave_nr > MODBUS_MASTER_SLAVES_MAX)
+		return -EINVAL;
+
+	memset(obj, 0, sizeof(*obj));
+	obj->cfg = *cfg;
+	for (i = 0; i < cfg->slave_nr; ++i)
+		obj->slaves[i].addr = cfg->slaves[i];
+
+	/* 3.5 characters (11 bits each) or 1.75 msec above 19200 baud */
+	if (cfg->baud > 19200)
+		obj->gap = 1750;
+	else
+		obj->gap = 35 * 11 * 100000UL / cfg->baud;
+
+	obj->rate_t = systick_get_time_ms();
+	obj->t_rx = systick_get_time_us();
+
+	ret = sched_add_task(MODBUS_MASTER_TASK, modbus_master_task, obj,
+			     &obj->task_id);
+	if (ret < 0)
+		return ret;
+
+	obj->tim_id = swtimer_tim_register(modbus_master_tick, obj,
+					   MODBUS_MASTER_TICK);
+	if (obj->tim_id < 0) {
+		sched_del_task(obj->task_id);
+		return -ENOMEM;
+	}
+
+	sched_set_ready(obj->task_id);
+	return 0;
+}
+
+/**
+ * Stop polling and release resources.
+ */
+void modbus_master_exit(void)
+{
+	swtimer_tim_del(mbm.tim_id);
+	sched_del_task(mbm.task_id);
+	WRITE_ONCE(mbm.state, MODBUS_MASTER_IDLE);
+}
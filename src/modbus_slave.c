@@ -0,0 +1,233 @@
+/**
+ * @file
+ *
+ * Modbus RTU slave exposing device data to a PLC/SCADA master.
+ *
+ * Data lives in an in-RAM register image updated by the application through
+ * setters, so requests are served without touching the sensors. Everything
+ * runs in the serial ISR: the RX line idle interrupt marks the end of request
+ * frame, the request is checked and the reply is built straight into a static
+ * buffer which is sent without copying. Turnaround is therefore about one
+ * character time plus CRC calculation, well under the 3.5 characters window,
+ * and doesn't depend on what the scheduler is busy with.
+ */
+
+#include "modbus_slave.h"
+#include "modbus.h"
+#include "serial.h"
+#include "common.h"
+#include <errno.h>
+#include <stddef.h>
+
+#define MODBUS_SLAVE_RESP_MAX						\
+	MODBUS_READ_RESP_LEN((int)MODBUS_IR_NR > (int)MODBUS_HR_NR ?	\
+			     MODBUS_IR_NR : MODBUS_HR_NR)
+
+struct modbus_slave_dev {
+	struct modbus_slave_cfg cfg;
+	uint16_t input[MODBUS_IR_NR];
+	uint16_t holding[MODBUS_HR_NR];
+	uint8_t req[FIFO_SIZE];
+	uint8_t resp[MODBUS_SLAVE_RESP_MAX];
+};
+
+static struct modbus_slave_dev mbs;
+
+/* Finish reply in obj->resp (CRC) and start sending it */
+static void modbus_slave_send(struct modbus_slave_dev *obj, uint16_t len)
+{
+	uint16_t crc;
+
+	crc = modbus_crc16(obj->resp, len);
+	obj->resp[len++] = crc & 0xff;
+	obj->resp[len++] = crc >> 8;
+
+	if (serial_send_frame(obj->cfg.usart, obj->resp, len) < 0)
+		obj->input[MODBUS_IR_BUSY_DROPS]++;
+}
+
+static void modbus_slave_exception(struct modbus_slave_dev *obj, uint8_t fc,
+				   uint8_t code)
+{
+	obj->input[MODBUS_IR_EXCEPTIONS]++;
+
+	obj->resp[0] = obj->cfg.addr;
+	obj->resp[1] = fc | MODBUS_FC_EXCEPTION;
+	obj->resp[2] = code;
+	modbus_slave_send(obj, MODBUS_EXCEPTION_LEN - 2);
+}
+
+/* Handle request frame of len bytes in obj->req */
+static void modbus_slave_handle(struct modbus_slave_dev *obj, uint16_t len)
+{
+	const uint8_t *req = obj->req;
+	const uint16_t *regs;
+	uint16_t regs_nr, start, count, crc, i;
+	uint8_t fc;
+
+	if (len < 4) {
+		obj->input[MODBUS_IR_BAD_FRAMES]++;
+		return;
+	}
+
+	crc = req[len - 2] | (req[len - 1] << 8);
+	if (modbus_crc16(req, len - 2) != crc) {
+		obj->input[MODBUS_IR_BAD_FRAMES]++;
+		return;
+	}
+
+	/* Other slave's request; broadcasts only carry writes, ignore them */
+	if (req[0] != obj->cfg.addr)
+		return;
+
+	/*
+	 * Master must not send a new request before our reply is done; if it
+	 * does, the reply is sent from obj->resp in place, so leave it alone.
+	 */
+	if (serial_frame_busy(obj->cfg.usart)) {
+		obj->input[MODBUS_IR_BUSY_DROPS]++;
+		return;
+	}
+
+	obj->input[MODBUS_IR_REQUESTS]++;
+
+	fc = req[1];
+	switch (fc) {
+	case MODBUS_FC_READ_INPUT:
+		regs = obj->input;
+		regs_nr = MODBUS_IR_NR;
+		break;
+	case MODBUS_FC_READ_HOLDING:
+		regs = obj->holding;
+		regs_nr = MODBUS_HR_NR;
+		break;
+	default:
+		modbus_slave_exception(obj, fc, MODBUS_EX_ILLEGAL_FUNCTION);
+		return;
+	}
+
+	if (len != MODBUS_READ_REQ_LEN) {
+		modbus_slave_exception(obj, fc, MODBUS_EX_ILLEGAL_VALUE);
+		return;
+	}
+
+	start = (req[2] << 8) | req[3];
+	count = (req[4] << 8) | req[5];
+	if (count == 0 || count > MODBUS_READ_MAX) {
+		modbus_slave_exception(obj, fc, MODBUS_EX_ILLEGAL_VALUE);
+		return;
+	}
+	if (start >= regs_nr || count > regs_nr - start) {
+		modbus_slave_exception(obj, fc, MODBUS_EX_ILLEGAL_ADDRESS);
+		return;
+	}
+
+	obj->resp[0] = obj->cfg.addr;
+	obj->resp[1] = fc;
+	obj->resp[2] = 2 * count;
+	for (i = 0; i < count; ++i) {
+		obj->resp[3 + 2 * i] = regs[start + i] >> 8;
+		obj->resp[4 + 2 * i] = regs[start + i] & 0xff;
+	}
+	modbus_slave_send(obj, MODBUS_READ_RESP_LEN(count) - 2);
+}
+
+/**
+ * Serial idle line callback: whole request frame is in RX FIFO.
+ *
+ * Called from USART ISR.
+ *
+ * @param data Unused
+ */
+void modbus_slave_idle(void *data)
+{
+	struct modbus_slave_dev *obj = &mbs;
+	int len;
+
+	UNUSED(data);
+
+	len = serial_receive_fifo(obj->cfg.usart, obj->req, sizeof(obj->req));
+	if (len <= 0)
+		return;
+
+	modbus_slave_handle(obj, len);
+}
+
+/**
+ * Set input register value.
+ *
+ * @param reg Register, enum modbus_slave_input
+ * @param val Register value
+ */
+void modbus_slave_set_input(int reg, uint16_t val)
+{
+	if (reg < 0 || reg >= MODBUS_IR_NR)
+		return;
+
+	WRITE_ONCE(mbs.input[reg], val);
+}
+
+/**
+ * Set 32-bit value into pair of input registers (high word goes first).
+ *
+ * Both words are updated atomically with respect to the reply building.
+ *
+ * @param reg First register of the pair, enum modbus_slave_input
+ * @param val Value
+ */
+void modbus_slave_set_input32(int reg, uint32_t val)
+{
+	unsigned long flags;
+
+	if (reg < 0 || reg + 1 >= MODBUS_IR_NR)
+		return;
+
+	enter_critical(flags);
+	mbs.input[reg] = val >> 16;
+	mbs.input[reg + 1] = val & 0xffff;
+	exit_critical(flags);
+}
+
+/**
+ * Set holding register value.
+ *
+ * @param reg Register, enum modbus_slave_holding
+ * @param val Register value
+ */
+void modbus_slave_set_holding(int reg, uint16_t val)
+{
+	if (reg < 0 || reg >= MODBUS_HR_NR)
+		return;
+
+	WRITE_ONCE(mbs.holding[reg], val);
+}
+
+/**
+ * Initialize Modbus slave.
+ *
+ * Serial port must be initialized with idle_cb = modbus_slave_idle.
+ *
+ * @param cfg Slave configuration; copied
+ * @return 0 on success or negative value on error
+ */
+int modbus_slave_init(const struct modbus_slave_cfg *cfg)
+{
+	struct modbus_slave_dev *obj = &mbs;
+	unsigned long flags;
+	int i;
+
+	if (cfg->addr == 0 || cfg->addr > 247)
+		return -EINVAL;
+
+	enter_critical(flags);
+	obj->cfg = *cfg;
+	for (i = 0; i < MODBUS_IR_NR; ++i)
+		obj->input[i] = 0;
+	for (i = 0; i < MODBUS_HR_NR; ++i)
+		obj->holding[i] = 0;
+	obj->input[MODBUS_IR_TEMPERATURE] = 0x8000;
+	obj->holding[MODBUS_HR_SLAVE_ADDR] = cfg->addr;
+	exit_critical(flags);
+
+	return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file
+ *
+ * Scrolling trend chart for SSD1306.
+ *
+ * A new sample shifts the plot one column left in the framebuffer and draws
+ * only the rightmost column, so the cost per sample doesn't depend on how
+ * many samples are on screen. The whole plot is redrawn only when the scale
+ * changes. When the plot covers whole pages and the controller can do
+ * content scroll (OLED_STEP_SCROLL=1), the shift is done by the controller
+ * (see ssd1306_scroll_step()), and only the new column is sent.
+ */
+
+#include "../inc/oled_chart.h"
+#include <errno.h>
+#include <string.h>
+
+/* n-th sample back from the newest one (0 - newest) */
+static uint16_t oled_chart_sample(const struct oled_chart *chart, uint8_t n)
+{
+	return chart->samples[(chart->head + chart->w - n) % (chart->w + 1)];
+}
+
+/* Samples on the screen; the extra one in the ring only joins the edge */
+static uint8_t oled_chart_visible(const struct oled_chart *chart)
+{
+	return (chart->count > chart->w) ? chart->w : chart->count;
+}
+
+/* Screen row of the value at current scale */
+static uint8_t oled_chart_row(const struct oled_chart *chart, uint16_t value)
+{
+	uint32_t off;
+
+	if (value <= chart->lo)
+		off = 0;
+	else if (value >= chart->hi)
+		off = chart->h - 1;
+	else
+		off = (uint32_t)(value - chart->lo) * (chart->h - 1) /
+		      (chart->hi - chart->lo);
+
+	return chart->y + chart->h - 1 - off;
+}
+
+/* Draw n-th sample back from the newest one into its column */
+static void oled_chart_column(const struct oled_chart *chart, uint8_t n)
+{
+	uint8_t x = chart->x + chart->w - 1 - n;
+	uint8_t row = oled_chart_row(chart, oled_chart_sample(chart, n));
+	uint8_t prev = row;
+
+	/* Join with the previous sample, so steep changes stay visible */
+	if (n + 1 < chart->count)
+		prev = oled_chart_row(chart, oled_chart_sample(chart, n + 1));
+
+	ssd1306_vline(x, chart->y, chart->y + chart->h - 1, BLACK);
+	ssd1306_vline(x, prev, row, WHITE);
+}
+
+/*
+ * Compute scale for samples in the ring buffer.
+ *
+ * @return true if the scale changed
+ */
+static bool oled_chart_rescale(struct oled_chart *chart)
+{
+	uint16_t min = 0xffff, max = 0, lo, hi, v;
+	uint8_t i;
+
+	for (i = 0; i < oled_chart_visible(chart); i++) {
+		v = oled_chart_sample(chart, i);
+		if (v < min)
+			min = v;
+		if (v > max)
+			max = v;
+	}
+
+	lo = min - min % chart->step;
+	hi = (max / chart->step + 1) * chart->step;
+	if (hi < max)		/* overflow */
+		hi = 0xffff;
+
+	if (chart->scaled && lo == chart->lo && hi == chart->hi)
+		return false;
+
+	chart->lo = lo;
+	chart->hi = hi;
+	chart->scaled = true;
+	return true;
+}
+
+/**
+ * Set up the chart and clear its area.
+ *
+ * @param chart Chart object
+ * @param x Left column of the plot area
+ * @param y Top row of the plot area
+ * @param w Plot width, pixels (one sample per column)
+ * @param h Plot height, pixels; with y and h multiples of 8 the plot is
+ *          scrolled by hardware (with OLED_STEP_SCROLL=1)
+ * @param step Scale granularity: bounds are multiples of it, so the scale
+ *             (and the whole plot) changes only on big moves
+ * @return 0 on success or -EINVAL on bad geometry
+ */
+int oled_chart_init(struct oled_chart *chart, uint8_t x, uint8_t y,
+		    uint8_t w, uint8_t h, uint16_t step)
+{
+	if (!w || w > OLED_CHART_MAX_WIDTH || h < 2 || !step ||
+	    x + w > SSD1306_WIDTH || y + h > SSD1306_HEIGHT)
+		return -EINVAL;
+
+	memset(chart, 0, sizeof(*chart));
+	chart->x = x;
+	chart->y = y;
+	chart->w = w;
+	chart->h = h;
+	chart->step = step;
+	chart->hw_scroll = (USE_OLED_STEP_SCROLL && y % 8 == 0 &&
+			    h % 8 == 0 && w > 1);
+
+	ssd1306_fill_rectangle(x, y, x + w - 1, y + h - 1, BLACK);
+
+	return 0;
+}
+
+/* Draw all samples from scratch */
+void oled_chart_redraw(struct oled_chart *chart)
+{
+	uint8_t n;
+
+	oled_chart_rescale(chart);
+
+	ssd1306_fill_rectangle(chart->x, chart->y, chart->x + chart->w - 1,
+			       chart->y + chart->h - 1, BLACK);
+
+	for (n = 0; n < oled_chart_visible(chart); n++)
+		oled_chart_column(chart, n);
+}
+
+/**
+ * Store sample without drawing, e.g. while the chart is not on screen; call
+ * oled_chart_redraw() to show it.
+ *
+ * @param chart Chart object
+ * @param value New sample
+ */
+void oled_chart_push(struct oled_chart *chart, uint16_t value)
+{
+	chart->samples[chart->head] = value;
+	chart->head = (chart->head + 1) % (chart->w + 1);
+	if (chart->count <= chart->w)
+		chart->count++;
+}
+
+/**
+ * Add sample: scroll the plot by one column and draw the new sample.
+ *
+ * The caller updates the screen afterwards.
+ *
+ * @param chart Chart object
+ * @param value New sample
+ */
+void oled_chart_add(struct oled_chart *chart, uint16_t value)
+{
+	oled_chart_push(chart, value);
+
+	if (oled_chart_rescale(chart)) {
+		oled_chart_redraw(chart);
+		return;
+	}
+
+	/*
+	 * Page-aligned plot is scrolled by the controller itself, so only the
+	 * new column goes over the bus
+	 */
+	if (!chart->hw_scroll ||
+	    ssd1306_scroll_step(chart->y / 8, (chart->y + chart->h - 1) / 8,
+				chart->x, chart->x + chart->w - 1,
+				SSD1306_SCROLL_LEFT) != 0) {
+		ssd1306_shift_left(chart->x, chart->y, chart->x + chart->w - 1,
+				   chart->y + chart->h - 1, 1);
+	}
+	oled_chart_column(chart, 0);
+}
@@ -0,0 +1,256 @@
+/**
+ * @file
+ *
+ * Pseudo-grayscale: 4 shades on the monochrome panel by alternating two
+ * bitplanes.
+ *
+ * Shade bit 0 goes to plane 0, bit 1 to plane 1. A hardware timer switches
+ * planes OLED_GRAY_HZ times per second and each plane is shown with its own
+ * contrast, the bit 1 plane twice as bright, so the eye sees 0, 1/3, 2/3
+ * and full brightness. Planes are sent straight from their buffers by
+ * ssd1306_present_plane(), contrast command going in front of the data, so
+ * the tick costs no copying and jitter is that of the timer interrupt (see
+ * oled_gray_init()).
+ *
+ * Every plane is a full frame: at 150 Hz that is 150 KiB/s, fine for the
+ * SPI transport (about 1 ms per plane at 9 MHz) but far beyond 400 kHz I2C
+ * (about 23 ms per plane): there most ticks are missed and it flickers.
+ *
+ * Planes are drawn in place; one tick may show a half-drawn change, which
+ * is not seen at this rate.
+ */
+
+#include "oled_gray.h"
+#include "oled_ssd1306.h"
+#include "common.h"
+#include "irq.h"
+#include <libopencm3/cm3/dwt.h>
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/timer.h>
+#include <stdbool.h>
+#include <string.h>
+
+struct oled_gray {
+	uint32_t planes[OLED_GRAY_PLANES][OLED_BUFF_LEN / 4];	/* word-aligned */
+	uint8_t contrast[OLED_GRAY_PLANES];
+	uint8_t plane;			/* plane on the screen */
+	struct swtimer_hw_tim hw_tim;
+	struct irq_action action;
+	struct oled_gray_stats stats;
+};
+
+static struct oled_gray gray;
+
+static inline uint8_t *oled_gray_plane(uint8_t n)
+{
+	return (uint8_t *)gray.planes[n];
+}
+
+/* Plane timer: show the other plane, unless the last one is still going */
+static irqreturn_t oled_gray_isr(int irq, void *data)
+{
+	struct oled_gray *obj = data;
+	uint32_t t0 = dwt_read_cycle_counter();
+	uint32_t dt;
+	uint8_t next = obj->plane ^ 1;
+
+	UNUSED(irq);
+
+	if (!timer_get_flag(obj->hw_tim.base, TIM_SR_UIF))
+		return IRQ_NONE;
+	timer_clear_flag(obj->hw_tim.base, TIM_SR_UIF);
+
+	obj->stats.ticks++;
+	if (ssd1306_present_plane(oled_gray_plane(next),
+				  obj->contrast[next]) == 0) {
+		obj->plane = next;
+		obj->stats.shown++;
+	} else {
+		obj->stats.missed++;
+	}
+
+	dt = dwt_read_cycle_counter() - t0;
+	obj->stats.cycles += dt;
+	if (dt > obj->stats.cycles_max)
+		obj->stats.cycles_max = dt;
+
+	return IRQ_HANDLED;
+}
+
+/**
+ * Set up plane timer; planes are cleared, nothing is shown until
+ * oled_gray_start().
+ *
+ * @param hw_tim Timer; psc and arr give plane period
+ * @return 0 on success or negative value on error
+ */
+int oled_gray_init(const struct swtimer_hw_tim *hw_tim)
+{
+	struct oled_gray *obj = &gray;
+	int ret;
+
+	obj->hw_tim = *hw_tim;
+	obj->contrast[0] = OLED_GRAY_CONTRAST_LO;
+	obj->contrast[1] = OLED_GRAY_CONTRAST_HI;
+	oled_gray_fill(0);
+
+	obj->action.handler = oled_gray_isr;
+	obj->action.irq = hw_tim->irq;
+	obj->action.name = "oled_gray";
+	obj->action.data = obj;
+	ret = irq_request(&obj->action);
+	if (ret)
+		return ret;
+
+	/* CPU cost of the tick; counter may be missing (stats read 0) */
+	dwt_enable_cycle_counter();
+
+	rcc_periph_reset_pulse(hw_tim->rst);
+	timer_set_mode(hw_tim->base, TIM_CR1_CKD_CK_INT, TIM_CR1_CMS_EDGE,
+		       TIM_CR1_DIR_UP);
+	timer_set_prescaler(hw_tim->base, hw_tim->psc);
+	timer_set_period(hw_tim->base, hw_tim->arr);
+	timer_disable_preload(hw_tim->base);
+	timer_continuous_mode(hw_tim->base);
+	timer_enable_update_event(hw_tim->base);
+	timer_update_on_overflow(hw_tim->base);
+	timer_enable_irq(hw_tim->base, TIM_DIER_UIE);
+
+	/*
+	 * Same priority as every other IRQ here (swtimer and RTC ask for 1
+	 * and 2, but F1 has only bits 7:4, so they are 0 too): the tick
+	 * doesn't preempt them. It is late by the longest handler or masked
+	 * section in front of it: up to 70 us of 1-Wire bit-banging slot
+	 * (OW_UART=0), a few us for the byte/event handlers (not measured).
+	 * That is ~1% of the 6.7 ms plane, not seen as flicker.
+	 */
+	nvic_set_priority(hw_tim->irq, 0);
+	nvic_enable_irq(hw_tim->irq);
+
+	return 0;
+}
+
+/* Take the screen over from the framebuffer and start switching planes */
+void oled_gray_start(void)
+{
+	memset(&gray.stats, 0, sizeof(gray.stats));
+	gray.plane = 1;		/* plane 0 goes first */
+
+	ssd1306_set_plane_mode(true);
+	timer_enable_counter(gray.hw_tim.base);
+}
+
+/*
+ * Stop switching planes and give the screen back to the framebuffer: it is
+ * rewritten whole by the next ssd1306_present() or ui frame.
+ */
+void oled_gray_stop(void)
+{
+	timer_disable_counter(gray.hw_tim.base);
+	ssd1306_set_plane_mode(false);
+	ssd1306_set_contrast(gray.contrast[1]);
+}
+
+/**
+ * Set plane contrasts. Panel brightness is not linear in contrast, so the
+ * shades may need tuning for a particular module.
+ *
+ * @param lo Contrast of bit 0 plane
+ * @param hi Contrast of bit 1 plane
+ */
+void oled_gray_set_contrast(uint8_t lo, uint8_t hi)
+{
+	gray.contrast[0] = lo;
+	gray.contrast[1] = hi;
+}
+
+void oled_gray_fill(uint8_t shade)
+{
+	uint8_t n;
+
+	for (n = 0; n < OLED_GRAY_PLANES; n++) {
+		memset(gray.planes[n], (shade & BIT(n)) ? 0xff : 0x00,
+		       OLED_BUFF_LEN);
+	}
+}
+
+/* Set rows of mask in columns x0..x1 of the page to the shade */
+static void oled_gray_page_span(uint8_t page, uint8_t x0, uint8_t x1,
+				uint8_t mask, uint8_t shade)
+{
+	uint16_t offs = page * SSD1306_WIDTH;
+	uint8_t n, x;
+
+	for (n = 0; n < OLED_GRAY_PLANES; n++) {
+		uint8_t *p = oled_gray_plane(n) + offs;
+
+		for (x = x0; x <= x1; x++) {
+			if (shade & BIT(n))
+				p[x] |= mask;
+			else
+				p[x] &= ~mask;
+		}
+	}
+}
+
+/**
+ * Fill rectangle with the shade; corners inclusive, clipped to the screen.
+ *
+ * @param x0 Left column
+ * @param y0 Top row
+ * @param x1 Right column
+ * @param y1 Bottom row
+ * @param shade 0 .. OLED_GRAY_SHADES - 1
+ */
+void oled_gray_fill_rect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1,
+			 uint8_t shade)
+{
+	uint8_t page, p0, p1, mask;
+
+	x1 = MIN(x1, SSD1306_WIDTH - 1);
+	y1 = MIN(y1, SSD1306_HEIGHT - 1);
+	if (x0 > x1 || y0 > y1)
+		return;
+
+	p0 = y0 / 8;
+	p1 = y1 / 8;
+	for (page = p0; page <= p1; page++) {
+		mask = 0xff;
+		if (page == p0)
+			mask &= 0xff << (y0 % 8);
+		if (page == p1)
+			mask &= 0xff >> (7 - y1 % 8);
+		oled_gray_page_span(page, x0, x1, mask, shade);
+	}
+}
+
+void oled_gray_pixel(uint8_t x, uint8_t y, uint8_t shade)
+{
+	oled_gray_fill_rect(x, y, x, y, shade);
+}
+
+/* Vertical line y0..y1 (in any order), e.g. a band column of a chart */
+void oled_gray_vline(uint8_t x, uint8_t y0, uint8_t y1, uint8_t shade)
+{
+	if (y0 > y1)
+		oled_gray_fill_rect(x, y1, x, y0, shade);
+	else
+		oled_gray_fill_rect(x, y0, x, y1, shade);
+}
+
+/**
+ * Take consistent snapshot of the counters. Planes per second is shown
+ * over elapsed time; CPU load is cycles over elapsed cycles. Only the host
+ * bench reads them so far.
+ *
+ * @param[out] stats Counters copy
+ */
+void oled_gray_get_stats(struct oled_gray_stats *stats)
+{
+	unsigned long flags;
+
+	enter_critical(flags);
+	*stats = gray.stats;
+	exit_critical(flags);
+}
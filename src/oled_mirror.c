@@ -0,0 +1,176 @@
+/**
+ * @file
+ *
+ * Display mirroring to the host over telemetry.
+ *
+ * The shadow copy holds the picture the host has. Every OLED_MIRROR_PERIOD
+ * the last presented frame is compared with it and one TELEMETRY_OLED record
+ * with XOR delta of the next changed bytes is sent, run-length encoded:
+ * unchanged bytes cost one token per run, so a new CO2 reading takes a
+ * couple of records. Shadow is only updated for records that went out.
+ *
+ * Records are sent only when serial TX FIFO has room for one more record
+ * and telemetry records on top of it, so mirroring never makes telemetry
+ * drop frames. With one record per 25 ms it takes a quarter of 115200 baud
+ * link at most, and nothing while the picture stays the same.
+ */
+
+#include "oled_mirror.h"
+#include "oled_ssd1306.h"
+#include "serial.h"
+#include "swtimer.h"
+#include "telemetry.h"
+#include "common.h"
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+/* TX FIFO room left for telemetry records (stats record is the biggest) */
+#define OLED_MIRROR_TX_RESERVE	48
+
+struct oled_mirror {
+	uint32_t usart;
+	uint8_t shadow[OLED_BUFF_LEN];	/* picture on the host */
+	uint16_t pos;			/* where to look for changes next */
+	uint16_t key_left;		/* ticks to the next key frame */
+	bool reset;			/* key frame: host clears the picture */
+	uint32_t bytes;			/* payload bytes sent */
+	uint8_t rec[TELEMETRY_PAYLOAD_MAX];
+};
+
+static struct oled_mirror mirror;
+
+/* First changed byte at or after pos, wrapping around; -1 if none */
+static int oled_mirror_find(const uint8_t *frame, const uint8_t *shadow,
+			    uint16_t pos)
+{
+	uint16_t i, n;
+
+	for (n = 0, i = pos; n < OLED_BUFF_LEN; n++) {
+		if (frame[i] != shadow[i])
+			return i;
+		if (++i == OLED_BUFF_LEN)
+			i = 0;
+	}
+
+	return -1;
+}
+
+/**
+ * Encode changes from *pos on into record tokens.
+ *
+ * @param frame Current picture
+ * @param shadow Picture on the host
+ * @param[in,out] pos First changed byte; set to the first byte not covered
+ * @param[out] out Tokens
+ * @param max Tokens buffer size
+ * @return Tokens length, in bytes
+ */
+uint16_t oled_mirror_encode(const uint8_t *frame, const uint8_t *shadow,
+			    uint16_t *pos, uint8_t *out, uint16_t max)
+{
+	uint16_t i = *pos, n = 0, run;
+
+	while (i < OLED_BUFF_LEN && n + 2 <= max) {
+		/* Unchanged run; not sent at the end of the picture */
+		for (run = 0; i + run < OLED_BUFF_LEN &&
+		     run < OLED_MIRROR_RUN_MAX &&
+		     frame[i + run] == shadow[i + run]; run++)
+			;
+		if (i + run == OLED_BUFF_LEN) {
+			i = OLED_BUFF_LEN;
+			break;
+		}
+		if (run) {
+			out[n++] = run - 1;
+			i += run;
+			continue;
+		}
+
+		/* Changed run; single unchanged bytes go along */
+		for (run = 0; i + run < OLED_BUFF_LEN &&
+		     run < OLED_MIRROR_RUN_MAX && n + 2 + run <= max; run++) {
+			if (frame[i + run] == shadow[i + run] &&
+			    (i + run + 1 == OLED_BUFF_LEN ||
+			     frame[i + run + 1] == shadow[i + run + 1]))
+				break;
+		}
+		out[n++] = 0x80 | (run - 1);
+		for (; run; run--, i++)
+			out[n++] = frame[i] ^ shadow[i];
+	}
+
+	*pos = i;
+
+	return n;
+}
+
+static void oled_mirror_tick(void *data)
+{
+	struct oled_mirror *obj = data;
+	const uint8_t *frame = ssd1306_get_frame();
+	uint16_t start, end, len;
+	int first;
+
+	if (!--obj->key_left) {
+		obj->key_left = OLED_MIRROR_KEY_PERIOD / OLED_MIRROR_PERIOD;
+		memset(obj->shadow, 0, sizeof(obj->shadow));
+		obj->reset = true;
+	}
+
+	/* Telemetry goes first */
+	if (serial_get_tx_free(obj->usart) <
+	    TELEMETRY_FRAME_MAX + OLED_MIRROR_TX_RESERVE)
+		return;
+
+	first = oled_mirror_find(frame, obj->shadow, obj->pos);
+	if (first < 0 && !obj->reset)
+		return;
+
+	start = end = (first < 0) ? 0 : first;
+	obj->rec[0] = obj->reset ? OLED_MIRROR_RESET : 0;
+	obj->rec[1] = start & 0xff;
+	obj->rec[2] = start >> 8;
+	len = OLED_MIRROR_HDR_LEN;
+	if (first >= 0)
+		len += oled_mirror_encode(frame, obj->shadow, &end,
+					  obj->rec + len, sizeof(obj->rec) - len);
+
+	if (telemetry_send(TELEMETRY_OLED, obj->rec, len))
+		return;
+
+	/* Host has these bytes now */
+	memcpy(&obj->shadow[start], &frame[start], end - start);
+	obj->pos = (end == OLED_BUFF_LEN) ? 0 : end;
+	obj->reset = false;
+	obj->bytes += len;
+}
+
+/**
+ * Start mirroring the display over telemetry.
+ *
+ * @param usart Telemetry serial port
+ * @return 0 on success or negative value on error
+ */
+int oled_mirror_init(uint32_t usart)
+{
+	struct oled_mirror *obj = &mirror;
+	int id;
+
+	obj->usart = usart;
+	obj->pos = 0;
+	/* Host may have anything: start with a key frame */
+	obj->key_left = 1;
+
+	id = swtimer_tim_register(oled_mirror_tick, obj, OLED_MIRROR_PERIOD);
+	if (id < 0)
+		return -ENOMEM;
+
+	return 0;
+}
+
+/* Record payload bytes sent so far */
+uint32_t oled_mirror_get_bytes(void)
+{
+	return mirror.bytes;
+}
@@ -1,25 +1,72 @@
 
 
 
-#include <libopencm3/stm32/rcc.h>
-#include <libopencm3/cm3/nvic.h>
-#include <libopencm3/stm32/exti.h>
-#include <libopencm3/stm32/f1/gpio.h>
-#include <libopencm3/stm32/i2c.h>
-
 #include "../inc/oled_ssd1306.h"
+#include "../inc/ssd1306_bus.h"
 #include "../inc/ssd1306_fonts.h"
-#include "../inc/board.h"
 #include "../inc/common.h"
 #include "../inc/errors.h"
-#include "../inc/i2c.h"
 
 #include "libprintf/printf.h"
 
+#include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+
+/*
+ * Two framebuffers: the application draws into ssd1306_buff (back buffer)
+ * while the previous frame goes out from ssd1306_front. They swap when a
+ * frame is presented, see ssd1306_present().
+ */
+static uint32_t ssd1306_buffs[2][OLED_BUFF_LEN / 4];	/* word-aligned */
+static uint8_t *ssd1306_buff = (uint8_t *)ssd1306_buffs[0];
+static uint8_t *ssd1306_front = (uint8_t *)ssd1306_buffs[1];
+
+/* Display transport, see ssd1306_bus.h */
+static const struct ssd1306_bus *ssd1306_bus = &ssd1306_i2c_bus;
+
+/* Changed columns of one page; x0 > x1 means the page is clean */
+struct ssd1306_span {
+	uint8_t x0;
+	uint8_t x1;
+};
+
+static struct ssd1306_span ssd1306_dirty[SSD1306_PAGES];
+static struct ssd1306_win ssd1306_wins[SSD1306_PAGES];
+
+/*
+ * Data of windows narrower than the screen but taller than one page: their
+ * rows are not contiguous in the framebuffer, so they are gathered here
+ * (4 digits of 16x26 font fit). Bigger ones go page by page.
+ */
+#define SSD1306_GATHER_LEN	256
+static uint8_t ssd1306_gather[SSD1306_GATHER_LEN];
+/* Windows of the current flush not finished yet (+1 while it is set up) */
+static volatile uint8_t ssd1306_flush_left;
+/* Called when the presented frame is on the screen */
+static ssd1306_present_cb_t ssd1306_present_cb;
+static void *ssd1306_present_data;
 
-// Screenbuffer
-static uint8_t ssd1306_buff[OLED_BUFF_LEN];
+/* Screen is fed by ssd1306_present_plane(), framebuffer waits */
+static volatile bool ssd1306_plane_mode;
+
+/* Mark columns x0..x1 of the page as changed */
+static inline void ssd1306_mark_dirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+	struct ssd1306_span *span = &ssd1306_dirty[page];
+
+	if (x0 < span->x0)
+		span->x0 = x0;
+	if (x1 > span->x1)
+		span->x1 = x1;
+}
+
+static inline void ssd1306_mark_clean(uint8_t page)
+{
+	ssd1306_dirty[page].x0 = 0xff;
+	ssd1306_dirty[page].x1 = 0;
+}
 
 // Screen objct
 //static oled_ssd1306_t oled_ssd1306;
@@ -27,7 +74,10 @@ static uint8_t ssd1306_buff[OLED_BUFF_LEN];
 uint32_t oled_i2c;
 
 void ssd1306_reset(oled_ssd1306_t *obj) {
-    /* for I2C - do nothing */
+	/* I2C modules have no RST line */
+	if (ssd1306_bus->reset)
+		ssd1306_bus->reset();
+
 	obj->x_pos = 0;
 	obj->y_pos = 0;
 	obj->inverted = 0;
@@ -40,139 +90,128 @@ void ssd1306_reset(oled_ssd1306_t *obj) {
 int  ssd1306_write_cmd(uint8_t byte) {
 	int ret;
 
-	ret = i2c_write_buf_poll(SSD1306_I2C_ADDR, COMMAND, &byte, 1);
+	ret = ssd1306_bus->write(COMMAND, &byte, 1);
 	if (ret != 0) {
 		printf("Error: Can't write data; err = %d\n", ret);
 		return ret;
 	}
+
+	return 0;
 }
 
-// Send data
-int ssd1306_write_data(uint8_t* buffer, uint16_t buff_size) {
+/**
+ * Send command stream: all commands go in one bus transfer (on I2C, behind
+ * one control byte, Co = 0, D/C# = 0).
+ *
+ * @param cmds Commands with their arguments
+ * @param len Stream length, in bytes
+ * @return 0 on success or negative value on error
+ */
+int ssd1306_write_cmds(const uint8_t *cmds, uint16_t len)
+{
 	int ret;
 
-	ret = i2c_write_buf_poll(SSD1306_I2C_ADDR, DATAONLY, buffer, buff_size);
+	ret = ssd1306_bus->write(COMMAND, cmds, len);
 	if (ret != 0) {
-		printf("Error: Can't write data; err = %d\n", ret);
+		printf("Error: Can't write commands; err = %d\n", ret);
 		return ret;
 	}
-}
-
-//Alternative init
-//static uint8_t cmds[] =  
-//			 0xAE, 0x00, 0x10, 0x40, 0x81, 0xCF, 0xA1, 0xA6 
-//			 0xA8, 0x3F, 0xD3, 0x00, 0xD5, 0x80, 0xD9, 0xF1 
-//			0xDA, 0x12, 0xDB, 0x40, 0x8D, 0x14, 0xAF, 0xFF  
-//
-//	 gpio_clear(GPIOC,GPIO13 
-//	 oled_reset 
-//	 for ( unsigned ux=0; cmds[ux] != 0xFF; ++ux  
-//	 	oled_command(cmds[ux     
-
-
 
+	return 0;
+}
 
-// Initialize the oled screen
-void ssd1306_init(oled_ssd1306_t *obj)
-{
+// Send data
+int ssd1306_write_data(uint8_t* buffer, uint16_t buff_size) {
 	int ret;
 
-	uint32_t oled_i2c = obj->i2c;
-
-	i2c_init(oled_i2c);
-
-	ret = i2c_detect_device(SSD1306_I2C_ADDR);
-	if (ret != 0)
-		printf("Cant find device on I2C bus, err = %d\n", ret);
-
-    // Reset OLED
-    ssd1306_reset(obj);
-
-    // Wait for the screen
-    mdelay(100);
-
-    // Init OLED
-    ssd1306_set_display_on(obj, 0); //display off
-
-    ssd1306_write_cmd(0x20); //Set Memory Addressing Mode
-
-    ssd1306_write_cmd(0x00); // 00b,Horizontal Addressing Mode; 01b,Vertical Addressing Mode;
-                                // 10b,Page Addressing Mode (RESET); 11b,Invalid
+	ret = ssd1306_bus->write(DATAONLY, buffer, buff_size);
+	if (ret != 0) {
+		printf("Error: Can't write data; err = %d\n", ret);
+		return ret;
+	}
 
-    ssd1306_write_cmd(0xB0); //Set Page Start Address for Page Addressing Mode,0-7
+	return 0;
+}
 
+/*
+ * Init sequence, sent as one command stream: the whole table goes in one
+ * bus transfer.
+ */
+static const uint8_t ssd1306_init_cmds[] = {
+	0xAE,		/* display off */
+	0x20, 0x00,	/* memory addressing mode: horizontal */
+	0xB0,		/* page start address for page addressing mode, 0-7 */
 #ifdef SSD1306_MIRROR_VERT
-    ssd1306_write_cmd(0xC0); // Mirror vertically
+	0xC0,		/* mirror vertically */
 #else
-    ssd1306_write_cmd(0xC8); //Set COM Output Scan Direction
+	0xC8,		/* COM output scan direction */
 #endif
-
-    ssd1306_write_cmd(0x00); //---set low column address
-    ssd1306_write_cmd(0x10); //---set high column address
-
-    ssd1306_write_cmd(0x40); //--set start line address - CHECK
-
-    ssd1306_set_contrast(0xFF);
-
+	0x00,		/* low column address */
+	0x10,		/* high column address */
+	0x40,		/* start line address */
+	0x81, 0xFF,	/* contrast */
 #ifdef SSD1306_MIRROR_HORIZ
-    ssd1306_write_cmd(0xA0); // Mirror horizontally
+	0xA0,		/* mirror horizontally */
 #else
-    ssd1306_write_cmd(0xA1); //--set segment re-map 0 to 127 - CHECK
+	0xA1,		/* segment re-map 0 to 127 */
 #endif
-
 #ifdef SSD1306_INVERSE_COLOR
-    ssd1306_write_cmd(0xA7); //--set inverse color
+	0xA7,		/* inverse color */
 #else
-    ssd1306_write_cmd(0xA6); //--set normal color
+	0xA6,		/* normal color */
 #endif
-
-// Set multiplex ratio.
+	/* Multiplex ratio */
 #if (SSD1306_HEIGHT == 128)
-    // Found in the Luma Python lib for SH1106.
-    ssd1306_write_cmd(0xFF);
+	0xFF,		/* found in the Luma Python lib for SH1106 */
 #else
-    ssd1306_write_cmd(0xA8); //--set multiplex ratio(1 to 64) - CHECK
+	0xA8,
 #endif
-
 #if (SSD1306_HEIGHT == 32)
-    ssd1306_write_cmd(0x1F); //
+	0x1F,
 #elif (SSD1306_HEIGHT == 64)
-    ssd1306_write_cmd(0x3F); //
+	0x3F,
 #elif (SSD1306_HEIGHT == 128)
-    ssd1306_write_cmd(0x3F); // Seems to work for 128px high displays too.
+	0x3F,		/* seems to work for 128px high displays too */
 #else
 #error "Only 32, 64, or 128 lines of height are supported!"
 #endif
-	
-	ssd1306_write_cmd(0xA4); //0xa4,Output follows RAM content;0xa5,Output ignores RAM content
-
-    ssd1306_write_cmd(0xD3); //-set display offset - CHECK
-    ssd1306_write_cmd(0x00); //-not offset
-
-    ssd1306_write_cmd(0xD5); //--set display clock divide ratio/oscillator frequency
-    ssd1306_write_cmd(0xF0); //--set divide ratio
-
-    ssd1306_write_cmd(0xD9); //--set pre-charge period
-    ssd1306_write_cmd(0x22); //
-
-    ssd1306_write_cmd(0xDA); //--set com pins hardware configuration - CHECK
+	0xA4,		/* output follows RAM content */
+	0xD3, 0x00,	/* display offset: none */
+	0xD5, 0xF0,	/* display clock divide ratio/oscillator frequency */
+	0xD9, 0x22,	/* pre-charge period */
+	/* COM pins hardware configuration */
 #if (SSD1306_HEIGHT == 32)
-    ssd1306_write_cmd(0x02);
-#elif (SSD1306_HEIGHT == 64)
-    ssd1306_write_cmd(0x12);
-#elif (SSD1306_HEIGHT == 128)
-    ssd1306_write_cmd(0x12);
+	0xDA, 0x02,
 #else
-#error "Only 32, 64, or 128 lines of height are supported!"
+	0xDA, 0x12,
 #endif
+	0xDB, 0x20,	/* vcomh: 0.77 x Vcc */
+	0x8D, 0x14,	/* DC-DC enable */
+	0xAF,		/* display on */
+};
 
-    ssd1306_write_cmd(0xDB); //--set vcomh
-    ssd1306_write_cmd(0x20); //0x20,0.77xVcc
+// Initialize the oled screen
+void ssd1306_init(oled_ssd1306_t *obj)
+{
+	int ret;
 
-    ssd1306_write_cmd(0x8D); //--set DC-DC enable
-    ssd1306_write_cmd(0x14); //
+	if (obj->bus)
+		ssd1306_bus = obj->bus;
 
-	ssd1306_set_display_on(obj, 1); //--turn on SSD1306 panel
+	ret = ssd1306_bus->init(obj);
+	if (ret != 0)
+		printf("Can't init %s bus, err = %d\n", ssd1306_bus->name, ret);
+
+    // Reset OLED
+    ssd1306_reset(obj);
+
+    // Wait for the screen
+    mdelay(100);
+
+    // Init OLED
+    ret = ssd1306_write_cmds(ssd1306_init_cmds, sizeof(ssd1306_init_cmds));
+    if (ret == 0)
+        obj->display_on = 1;
 
     // Clear screen
     ssd1306_fill(BLACK);
@@ -200,36 +239,290 @@ void ssd1306_set_display_on(oled_ssd1306_t * obj, const uint8_t on) {
 }
 
 void ssd1306_set_contrast(const uint8_t value) {
-    const uint8_t set_contrast_control_register = 0x81;
-    ssd1306_write_cmd(set_contrast_control_register);
-    ssd1306_write_cmd(value);
+    const uint8_t cmds[] = { 0x81, value }; // contrast control register
+
+    ssd1306_write_cmds(cmds, sizeof(cmds));
 }
 
 // Fill the whole screen with the given color
 void ssd1306_fill(oled_color_t color) {
-    /* Set memory */
+    /* Set memory a word at a time */
+    uint32_t *p = (uint32_t *)ssd1306_buff;
+    uint32_t val = (color == BLACK) ? 0x00000000 : 0xFFFFFFFF;
     uint32_t i;
 
-    for(i = 0; i < OLED_BUFF_LEN; i++) {
-        ssd1306_buff[i] = (color == BLACK) ? 0x00 : 0xFF;
-    }
+    for (i = 0; i < OLED_BUFF_LEN / 4; i++)
+        p[i] = val;
+
+    for (i = 0; i < SSD1306_PAGES; i++)
+        ssd1306_mark_dirty(i, 0, SSD1306_WIDTH - 1);
+}
+
+static void ssd1306_flush_put(void);
+
+/* Queue one address window: pages p0..p1, columns x0..x1 */
+static void ssd1306_flush_win(struct ssd1306_win *win, uint8_t p0, uint8_t p1,
+			      uint8_t x0, uint8_t x1, const uint8_t *data)
+{
+	win->cmds[0] = 0x21;
+	win->cmds[1] = x0;
+	win->cmds[2] = x1;
+	win->cmds[3] = 0x22;
+	win->cmds[4] = p0;
+	win->cmds[5] = p1;
+	win->cmd_len = 6;
+	win->idx = win - ssd1306_wins;
+	win->data = data;
+	win->len = (p1 - p0 + 1) * (x1 - x0 + 1);
+
+	ssd1306_flush_left++;
+	if (ssd1306_bus->flush(win) != 0) {
+		/* Lost window gets to the next frame */
+		for (; p0 <= p1; p0++)
+			ssd1306_mark_dirty(p0, x0, x1);
+		ssd1306_flush_left--;
+	}
 }
 
-// Write the screenbuffer with changed to the screen
+static inline bool ssd1306_same_span(uint8_t a, uint8_t b)
+{
+	return ssd1306_dirty[a].x0 == ssd1306_dirty[b].x0 &&
+	       ssd1306_dirty[a].x1 == ssd1306_dirty[b].x1;
+}
+
+/*
+ * Queue address windows covering changed parts of the front buffer. The
+ * changes are copied to the back buffer as well, so it holds the same frame
+ * again and drawing goes on from there.
+ *
+ * Run of pages with the same changed columns (e.g. a glyph cell) goes as
+ * one window: one address setup and one data transfer instead of one per
+ * page.
+ */
+static void ssd1306_flush_start(void)
+{
+	uint8_t page = 0, first, last, n = 0;
+	uint16_t gathered = 0, w, offs;
+	const uint8_t *data;
+
+	while (page < SSD1306_PAGES) {
+		struct ssd1306_span span = ssd1306_dirty[page];
+
+		if (span.x0 > span.x1) {
+			page++;
+			continue;
+		}
+
+		first = last = page;
+		while (last + 1 < SSD1306_PAGES && ssd1306_same_span(page,
+								      last + 1))
+			last++;
+
+		w = span.x1 - span.x0 + 1;
+		data = &ssd1306_front[first * SSD1306_WIDTH + span.x0];
+		if (last > first && w < SSD1306_WIDTH) {
+			/* Rows of a narrow window are SSD1306_WIDTH apart */
+			if (gathered + (last - first + 1) * w <=
+			    SSD1306_GATHER_LEN) {
+				data = &ssd1306_gather[gathered];
+				for (page = first; page <= last; page++) {
+					offs = page * SSD1306_WIDTH + span.x0;
+					memcpy(&ssd1306_gather[gathered],
+					       &ssd1306_front[offs], w);
+					gathered += w;
+				}
+			} else {
+				last = first;
+			}
+		}
+
+		for (page = first; page <= last; page++) {
+			offs = page * SSD1306_WIDTH + span.x0;
+			memcpy(&ssd1306_buff[offs], &ssd1306_front[offs], w);
+			ssd1306_mark_clean(page);
+		}
+
+		ssd1306_flush_win(&ssd1306_wins[n++], first, last, span.x0,
+				  span.x1, data);
+	}
+}
+
+/*
+ * Swap buffers and send the new front one. Called from task context only
+ * (never from the bus ISR: drawing may hold pointers into the back buffer),
+ * with interrupts disabled and no frame in flight.
+ */
+static void ssd1306_present_start(ssd1306_present_cb_t cb, void *data)
+{
+	uint8_t *front = ssd1306_buff;
+
+	/* Hold the frame, so it doesn't complete while being set up */
+	ssd1306_flush_left = 1;
+	ssd1306_present_cb = cb;
+	ssd1306_present_data = data;
+
+	ssd1306_buff = ssd1306_front;
+	ssd1306_front = front;
+	ssd1306_flush_start();
+
+	ssd1306_flush_put();
+}
+
+/* Drop one reference to the frame in flight; the last one completes it */
+static void ssd1306_flush_put(void)
+{
+	ssd1306_present_cb_t cb = ssd1306_present_cb;
+
+	if (--ssd1306_flush_left)
+		return;
+
+	ssd1306_present_cb = NULL;
+	if (cb)
+		cb(ssd1306_present_data);
+
+	/*
+	 * No swap here, even if something was drawn meanwhile: the task may be
+	 * in the middle of drawing into the back buffer. The changes stay
+	 * dirty and go out with the next present from the task.
+	 */
+}
+
+/**
+ * Window went out (called from ISR by the bus).
+ *
+ * @param win Window passed to the bus flush
+ * @param status 0 on success or negative value if the window was lost
+ */
+void ssd1306_flush_done(const struct ssd1306_win *win, int status)
+{
+	/* Address commands are the last ones */
+	const uint8_t *addr = &win->cmds[win->cmd_len - 6];
+	uint8_t page;
+
+	/*
+	 * Lost window gets to the next frame: back buffer holds the same data
+	 * there, as it was synced when the frame was presented.
+	 */
+	if (status != 0) {
+		for (page = addr[4]; page <= addr[5]; page++)
+			ssd1306_mark_dirty(page, addr[1], addr[2]);
+	}
+
+	ssd1306_flush_put();
+}
+
+/**
+ * Send the frame drawn so far to the screen.
+ *
+ * Returns at once: the frame goes out in bus/DMA interrupts from the front
+ * buffer, while drawing goes on in the back buffer, which already holds the
+ * same frame. Only one frame can be in flight; wait for @p cb before
+ * presenting the next one.
+ *
+ * @param cb Called when the frame is on the screen (from ISR); may be NULL
+ * @param data Argument for @p cb
+ * @return 0 on success or -EBUSY if the previous frame is still going out
+ *         (or the screen is in plane mode)
+ */
+int ssd1306_present(ssd1306_present_cb_t cb, void *data)
+{
+	unsigned long flags;
+	int ret = 0;
+
+	enter_critical(flags);
+	if (ssd1306_flush_left || ssd1306_plane_mode)
+		ret = -EBUSY;
+	else
+		ssd1306_present_start(cb, data);
+	exit_critical(flags);
+
+	return ret;
+}
+
+/**
+ * Hand the screen over to ssd1306_present_plane() or take it back.
+ *
+ * While in plane mode, ssd1306_present() returns -EBUSY and
+ * ssd1306_update_screen() does nothing, so drawing can go on. When plane
+ * mode is over, the next frame rewrites the whole screen.
+ *
+ * @param on true: enter plane mode, false: leave it
+ */
+void ssd1306_set_plane_mode(bool on)
+{
+	unsigned long flags;
+	uint8_t page;
+
+	enter_critical(flags);
+	ssd1306_plane_mode = on;
+	if (!on) {
+		for (page = 0; page < SSD1306_PAGES; page++)
+			ssd1306_mark_dirty(page, 0, SSD1306_WIDTH - 1);
+	}
+	exit_critical(flags);
+}
+
+/**
+ * Send whole frame from caller's buffer, with contrast set right before it.
+ *
+ * Framebuffers are bypassed: nothing is copied, the buffer must stay
+ * untouched until the next call succeeds. Used to alternate bitplanes for
+ * pseudo-grayscale, see oled_gray.c. Can be called from ISR.
+ *
+ * @param plane Frame in framebuffer layout, OLED_BUFF_LEN bytes
+ * @param contrast Contrast to show the frame with
+ * @return 0 on success, -EBUSY if the previous frame is still going out,
+ *         -EINVAL if not in plane mode or negative value on bus error
+ */
+int ssd1306_present_plane(const uint8_t *plane, uint8_t contrast)
+{
+	struct ssd1306_win *win = &ssd1306_wins[0];
+	unsigned long flags;
+	int ret = 0;
+
+	enter_critical(flags);
+	if (!ssd1306_plane_mode) {
+		ret = -EINVAL;
+	} else if (ssd1306_flush_left) {
+		ret = -EBUSY;
+	} else {
+		win->cmds[0] = 0x81;
+		win->cmds[1] = contrast;
+		win->cmds[2] = 0x21;
+		win->cmds[3] = 0;
+		win->cmds[4] = SSD1306_WIDTH - 1;
+		win->cmds[5] = 0x22;
+		win->cmds[6] = 0;
+		win->cmds[7] = SSD1306_PAGES - 1;
+		win->cmd_len = 8;
+		win->idx = 0;
+		win->data = plane;
+		win->len = OLED_BUFF_LEN;
+
+		ssd1306_flush_left = 1;
+		ret = ssd1306_bus->flush(win);
+		if (ret != 0)
+			ssd1306_flush_left = 0;
+	}
+	exit_critical(flags);
+
+	return ret;
+}
+
+// Write the changed parts of screenbuffer to the screen
+//
+// Returns at once. If a frame is still going out, nothing is sent now: the
+// changes stay dirty and go out with the next ssd1306_update_screen() or
+// ssd1306_present() call (use the latter's return value to retry).
 void ssd1306_update_screen(void) {
-    // Write data to each page of RAM. Number of pages
-    // depends on the screen height:
-    //
-    //  * 32px   ==  4 pages
-    //  * 64px   ==  8 pages
-    //  * 128px  ==  16 pages
-    for(uint8_t i = 0; i < SSD1306_HEIGHT/8; i++) {
-        ssd1306_write_cmd(0xB0 + i); // Set the current RAM page address.
-        ssd1306_write_cmd(0x00);
-        ssd1306_write_cmd(0x10);
-        ssd1306_write_data(&ssd1306_buff[SSD1306_WIDTH*i],SSD1306_WIDTH);
-    }
+    unsigned long flags;
+
+    enter_critical(flags);
+    if (!ssd1306_plane_mode && !ssd1306_flush_left)
+        ssd1306_present_start(NULL, NULL);
+    exit_critical(flags);
 }
+
 //    Draw one pixel in the screenbuffer
 //    X => X Coordinate
 //    Y => Y Coordinate
@@ -246,11 +539,170 @@ void ssd1306_draw_pixel(uint8_t x, uint8_t y, oled_color_t color) {
 //    }
     
     // Draw in the right color
+    uint8_t *p = &ssd1306_buff[x + (y / 8) * SSD1306_WIDTH];
+    uint8_t old = *p;
+
     if(color == WHITE) {
-        ssd1306_buff[x + (y / 8) * SSD1306_WIDTH] |= 1 << (y % 8);
+        *p |= 1 << (y % 8);
     } else { 
-        ssd1306_buff[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8));
+        *p &= ~(1 << (y % 8));
     }
+
+    // Only real changes go to the screen
+    if (*p != old)
+        ssd1306_mark_dirty(y / 8, x, x);
+}
+
+/* Replace masked bits of the framebuffer byte; true if the byte changed */
+static inline bool ssd1306_put_bits(uint8_t *p, uint8_t mask, uint8_t bits)
+{
+	uint8_t old = *p;
+
+	*p = (old & ~mask) | bits;
+	return *p != old;
+}
+
+/*
+ * Copy bitmap in page layout (rows of w bytes, bit 0 is the top pixel) to
+ * the framebuffer at x, y. The whole w x h cell is written: pixels not set
+ * in the bitmap get the opposite color. When y is not page-aligned, each
+ * source byte is split between two framebuffer pages by shift and mask.
+ * The caller makes sure the cell fits the screen.
+ */
+static void ssd1306_blit_pages(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+			       const uint8_t *src, oled_color_t color)
+{
+	const uint8_t shift = y % 8;
+	const uint8_t inv = (color == WHITE) ? 0x00 : 0xff;
+	uint8_t page = y / 8;
+	uint8_t row, col;
+
+	for (row = 0; row < h; row += 8, page++, src += w) {
+		uint8_t rows = (h - row < 8) ? h - row : 8;
+		uint16_t mask = ((1 << rows) - 1) << shift;
+		uint8_t *lo = &ssd1306_buff[page * SSD1306_WIDTH + x];
+		uint8_t *hi = lo + SSD1306_WIDTH;
+		bool lo_changed = false, hi_changed = false;
+
+		for (col = 0; col < w; col++) {
+			uint16_t bits = ((src[col] ^ inv) << shift) & mask;
+
+			lo_changed |= ssd1306_put_bits(&lo[col], mask, bits);
+			if (mask >> 8)
+				hi_changed |= ssd1306_put_bits(&hi[col],
+							       mask >> 8,
+							       bits >> 8);
+		}
+
+		if (lo_changed)
+			ssd1306_mark_dirty(page, x, x + w - 1);
+		if (hi_changed)
+			ssd1306_mark_dirty(page + 1, x, x + w - 1);
+	}
+}
+
+/* Sequential reader of packed glyph bits, see tools/font_compiler.py */
+struct font_reader {
+	const uint8_t *p;
+	uint8_t byte;		/* bits of the current byte not read yet */
+	uint8_t nbits;		/* how many of them */
+	uint8_t val;		/* RLE: value of the current run */
+	uint16_t run;		/* RLE: bits left in the current run */
+};
+
+/* Read n <= 32 raw bits, first bit goes to bit 0 */
+static uint32_t font_read_bits(struct font_reader *r, uint8_t n)
+{
+	uint32_t v = 0;
+	uint8_t got = 0;
+
+	while (got < n) {
+		uint8_t k = n - got;
+
+		if (!r->nbits) {
+			r->byte = *r->p++;
+			r->nbits = 8;
+		}
+		if (k > r->nbits)
+			k = r->nbits;
+
+		v |= (uint32_t)(r->byte & ((1 << k) - 1)) << got;
+		r->byte >>= k;
+		r->nbits -= k;
+		got += k;
+	}
+
+	return v;
+}
+
+/* Read n <= 32 bits of run-length encoded glyph */
+static uint32_t font_read_runs(struct font_reader *r, uint8_t n)
+{
+	uint32_t v = 0;
+	uint8_t got = 0;
+
+	while (got < n) {
+		uint8_t k = n - got;
+
+		while (!r->run) {
+			uint8_t code;
+
+			r->val ^= 1;
+			do {
+				code = font_read_bits(r, 4);
+				r->run += code;
+			} while (code == 15);
+		}
+		if (k > r->run)
+			k = r->run;
+
+		if (r->val)
+			v |= (k == 32 ? 0xffffffff : (1UL << k) - 1) << got;
+		r->run -= k;
+		got += k;
+	}
+
+	return v;
+}
+
+/*
+ * Decode packed glyph into page layout (rows of w bytes, bit 0 on top), so
+ * it goes to the framebuffer the same way as glyphs stored in page layout.
+ */
+static void font_decode(const font_def_t *font, uint16_t glyph, uint8_t *out)
+{
+	struct font_reader r = {
+		.p = &font->packed[font->offsets[glyph]],
+		.val = 1,	/* first run is 0s */
+	};
+	const uint8_t w = font->font_width;
+	const uint8_t pages = FONT_PAGES(*font);
+	uint8_t col, page;
+
+	for (col = 0; col < w; col++) {
+		uint32_t bits = (font->flags & FONT_RLE) ?
+				font_read_runs(&r, font->font_height) :
+				font_read_bits(&r, font->font_height);
+
+		for (page = 0; page < pages; page++, bits >>= 8)
+			out[page * w + col] = bits;
+	}
+}
+
+/* Glyph number of the character in the font, or -1 if there is none */
+static int font_glyph_index(const font_def_t *font, char ch)
+{
+	const char *c;
+
+	if (!font->chars)
+		return (ch >= 32 && ch <= 126) ? ch - 32 : -1;
+
+	for (c = font->chars; *c; c++) {
+		if (*c == ch)
+			return c - font->chars;
+	}
+
+	return -1;
 }
 
 // Draw 1 char to the screen buffer
@@ -259,9 +711,11 @@ void ssd1306_draw_pixel(uint8_t x, uint8_t y, oled_color_t color) {
 // color    => Black or White
 char ssd1306_write_char(oled_ssd1306_t *obj, char ch, font_def_t font, oled_color_t color) {
     uint32_t i, b, j;
+    int glyph;
 
     // Check if character is valid
-    if (ch < 32 || ch > 126)
+    glyph = font_glyph_index(&font, ch);
+    if (glyph < 0)
         return 0;
 
     // Check remaining space on current line
@@ -272,9 +726,30 @@ char ssd1306_write_char(oled_ssd1306_t *obj, char ch, font_def_t font, oled_colo
         return 0;
     }
 
+    if (font.pages) {
+        // Whole bytes at once, glyph is already in display RAM layout
+        ssd1306_blit_pages(obj->x_pos, obj->y_pos, font.font_width,
+                           font.font_height,
+                           &font.pages[glyph * FONT_GLYPH_SIZE(font)],
+                           color);
+        obj->x_pos += font.font_width;
+        return ch;
+    }
+
+    if (font.packed) {
+        // Unpack into page layout on the fly, then the same as above
+        uint8_t cell[FONT_MAX_WIDTH * FONT_MAX_HEIGHT / 8];
+
+        font_decode(&font, glyph, cell);
+        ssd1306_blit_pages(obj->x_pos, obj->y_pos, font.font_width,
+                           font.font_height, cell, color);
+        obj->x_pos += font.font_width;
+        return ch;
+    }
+
     // Use the font to write
     for(i = 0; i < font.font_height; i++) {
-        b = font.data[(ch - 32) * font.font_height + i];
+        b = font.data[glyph * font.font_height + i];
         for(j = 0; j < font.font_width; j++) {
             if((b << j) & 0x8000)  {
                 ssd1306_draw_pixel(obj->x_pos + j, (obj->y_pos + i), (oled_color_t) color);
@@ -313,3 +788,690 @@ void ssd1306_set_cursor(oled_ssd1306_t * obj, uint8_t x, uint8_t y) {
     obj->x_pos = x;
     obj->y_pos = y;
 }
+
+/**
+ * Draw bitmap in page layout (rows of w bytes, bit 0 is the top pixel).
+ *
+ * Bitmap pixels get the color, the rest of the w x h cell the opposite one.
+ *
+ * @return 0 on success or -EINVAL if the cell does not fit the screen
+ */
+int ssd1306_draw_bitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+			const uint8_t *bitmap, oled_color_t color)
+{
+	if (!w || !h || x + w > SSD1306_WIDTH || y + h > SSD1306_HEIGHT)
+		return -EINVAL;
+
+	ssd1306_blit_pages(x, y, w, h, bitmap, color);
+	return 0;
+}
+
+/* Sequential reader of bitmap asset bytes, see tools/icon_compiler.py */
+struct bitmap_reader {
+	const uint8_t *p;
+	bool rle;
+	uint8_t lit;		/* RLE: literal bytes left */
+	uint8_t rep;		/* RLE: repeats of val left */
+	uint8_t val;
+};
+
+static inline uint8_t bitmap_read(struct bitmap_reader *r)
+{
+	uint8_t c;
+
+	if (!r->rle || r->lit) {
+		if (r->lit)
+			r->lit--;
+		return *r->p++;
+	}
+	if (r->rep) {
+		r->rep--;
+		return r->val;
+	}
+
+	c = *r->p++;
+	if (c < 0x80) {
+		r->lit = c;
+		return *r->p++;
+	}
+	r->val = *r->p++;
+	r->rep = c - 126;	/* this one goes out now */
+	return r->val;
+}
+
+/**
+ * Draw bitmap asset (tools/icon_compiler.py) with its top left corner at
+ * x, y, decoding it straight into the framebuffer.
+ *
+ * Bitmap pixels get the color, the rest of the bitmap the opposite one, so
+ * BLACK draws it inverted. Only the part inside the clip rectangle (and the
+ * screen) is drawn; the bitmap may start off screen.
+ *
+ * @param bmp Bitmap
+ * @param x Left column, may be negative
+ * @param y Top row, may be negative
+ * @param color Color of bitmap pixels
+ * @param clip Clip rectangle; NULL: whole screen
+ */
+void ssd1306_blit(const bitmap_def_t *bmp, int16_t x, int16_t y,
+		  oled_color_t color, const oled_rect_t *clip)
+{
+	struct bitmap_reader r = {
+		.p = bmp->data,
+		.rle = bmp->flags & BITMAP_RLE,
+	};
+	const uint8_t inv = (color == WHITE) ? 0x00 : 0xff;
+	int16_t cx0 = 0, cy0 = 0, cx1 = SSD1306_WIDTH - 1;
+	int16_t cy1 = SSD1306_HEIGHT - 1;
+	int16_t top, lo, hi, dx, page;
+	uint8_t row, col, shift, mask, bits;
+
+	if (clip) {
+		cx0 = MAX(cx0, clip->x0);
+		cy0 = MAX(cy0, clip->y0);
+		cx1 = MIN(cx1, clip->x1);
+		cy1 = MIN(cy1, clip->y1);
+	}
+	cx0 = MAX(cx0, x);
+	cy0 = MAX(cy0, y);
+	cx1 = MIN(cx1, x + bmp->width - 1);
+	cy1 = MIN(cy1, y + bmp->height - 1);
+	if (cx0 > cx1 || cy0 > cy1)
+		return;
+
+	for (row = 0; row < (bmp->height + 7) / 8; row++) {
+		/* Source byte bits lo..hi are inside the clip rectangle */
+		top = y + row * 8;
+		lo = MAX(cy0 - top, 0);
+		hi = MIN(cy1 - top, 7);
+		mask = (lo <= hi) ? (0xff >> (7 - hi)) & (0xff << lo) : 0;
+
+		/* Bit 0 goes to this page at shift (page may be -1) */
+		page = (top + 8) / 8 - 1;
+		shift = top - page * 8;
+
+		for (col = 0; col < bmp->width; col++) {
+			bits = (bitmap_read(&r) ^ inv) & mask;
+			dx = x + col;
+			if (!mask || dx < cx0 || dx > cx1)
+				continue;
+
+			if (page >= 0 &&
+			    ssd1306_put_bits(&ssd1306_buff[page * SSD1306_WIDTH +
+							   dx],
+					     mask << shift, bits << shift))
+				ssd1306_mark_dirty(page, dx, dx);
+			if (shift && page + 1 < SSD1306_PAGES &&
+			    ssd1306_put_bits(&ssd1306_buff[(page + 1) *
+							   SSD1306_WIDTH + dx],
+					     mask >> (8 - shift),
+					     bits >> (8 - shift)))
+				ssd1306_mark_dirty(page + 1, dx, dx);
+		}
+
+		/* Rest of the bitmap is below the clip rectangle */
+		if (top + 7 >= cy1)
+			break;
+	}
+}
+
+/*
+ * Set (WHITE) or clear (BLACK) mask bits in columns x0..x1 of the page:
+ * one byte write covers up to 8 pixel rows.
+ */
+static void ssd1306_page_span(uint8_t page, uint8_t x0, uint8_t x1,
+			      uint8_t mask, oled_color_t color)
+{
+	uint8_t *p = &ssd1306_buff[page * SSD1306_WIDTH + x0];
+	uint8_t *end = p + (x1 - x0);
+	bool changed = false;
+
+	do {
+		uint8_t old = *p;
+
+		*p = (color == WHITE) ? old | mask : old & ~mask;
+		changed |= *p != old;
+	} while (p++ != end);
+
+	if (changed)
+		ssd1306_mark_dirty(page, x0, x1);
+}
+
+/* Order the pair and clip to the screen; false if nothing is left */
+static bool ssd1306_clip(uint8_t *a0, uint8_t *a1, uint8_t max)
+{
+	uint8_t t;
+
+	if (*a0 > *a1) {
+		t = *a0;
+		*a0 = *a1;
+		*a1 = t;
+	}
+	if (*a0 >= max)
+		return false;
+	if (*a1 >= max)
+		*a1 = max - 1;
+
+	return true;
+}
+
+/**
+ * Fill rectangle with corners (x1, y1) and (x2, y2), inclusive.
+ *
+ * Goes page by page, so every framebuffer byte is written once.
+ */
+void ssd1306_fill_rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+			    oled_color_t color)
+{
+	uint8_t page, last;
+
+	if (!ssd1306_clip(&x1, &x2, SSD1306_WIDTH) ||
+	    !ssd1306_clip(&y1, &y2, SSD1306_HEIGHT))
+		return;
+
+	last = y2 / 8;
+	for (page = y1 / 8; page <= last; page++) {
+		uint8_t mask = 0xff;
+
+		if (page == y1 / 8)
+			mask &= 0xff << (y1 % 8);
+		if (page == last)
+			mask &= 0xff >> (7 - y2 % 8);
+
+		ssd1306_page_span(page, x1, x2, mask, color);
+	}
+}
+
+/* Horizontal line from x1 to x2 at row y */
+void ssd1306_hline(uint8_t x1, uint8_t x2, uint8_t y, oled_color_t color)
+{
+	if (y >= SSD1306_HEIGHT || !ssd1306_clip(&x1, &x2, SSD1306_WIDTH))
+		return;
+
+	ssd1306_page_span(y / 8, x1, x2, 1 << (y % 8), color);
+}
+
+/* Vertical line from y1 to y2 at column x */
+void ssd1306_vline(uint8_t x, uint8_t y1, uint8_t y2, oled_color_t color)
+{
+	ssd1306_fill_rectangle(x, y1, x, y2, color);
+}
+
+/* Draw line with Bresenham's algorithm */
+void ssd1306_line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+		  oled_color_t color)
+{
+	int16_t dx, dy, sx, sy, err, e2;
+
+	if (y1 == y2) {
+		ssd1306_hline(x1, x2, y1, color);
+		return;
+	}
+	if (x1 == x2) {
+		ssd1306_vline(x1, y1, y2, color);
+		return;
+	}
+
+	dx = (x2 > x1) ? x2 - x1 : x1 - x2;
+	dy = (y2 > y1) ? y1 - y2 : y2 - y1;	/* negative */
+	sx = (x1 < x2) ? 1 : -1;
+	sy = (y1 < y2) ? 1 : -1;
+	err = dx + dy;
+
+	for (;;) {
+		ssd1306_draw_pixel(x1, y1, color);
+		if (x1 == x2 && y1 == y2)
+			break;
+
+		e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x1 += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y1 += sy;
+		}
+	}
+}
+
+/* Draw lines through the vertices */
+void ssd1306_polyline(const oledd_vertex_t *par_vertex, uint16_t par_size,
+		      oled_color_t color)
+{
+	uint16_t i;
+
+	if (!par_vertex)
+		return;
+
+	for (i = 1; i < par_size; i++) {
+		ssd1306_line(par_vertex[i - 1].x, par_vertex[i - 1].y,
+			     par_vertex[i].x, par_vertex[i].y, color);
+	}
+}
+
+/* Draw rectangle outline with corners (x1, y1) and (x2, y2) */
+void ssd1306_draw_rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+			    oled_color_t color)
+{
+	ssd1306_hline(x1, x2, y1, color);
+	ssd1306_hline(x1, x2, y2, color);
+	ssd1306_vline(x1, y1, y2, color);
+	ssd1306_vline(x2, y1, y2, color);
+}
+
+/* Pixel at offset (dx, dy) from the center, if it is on the screen */
+static void ssd1306_draw_offset(uint8_t x, uint8_t y, int16_t dx, int16_t dy,
+				oled_color_t color)
+{
+	int16_t px = x + dx, py = y + dy;
+
+	if (px >= 0 && px < SSD1306_WIDTH && py >= 0 && py < SSD1306_HEIGHT)
+		ssd1306_draw_pixel(px, py, color);
+}
+
+/* Draw circle with midpoint algorithm */
+void ssd1306_draw_circle(uint8_t par_x, uint8_t par_y, uint8_t par_r,
+			 oled_color_t color)
+{
+	int16_t x = par_r, y = 0, err = 1 - par_r;
+
+	while (x >= y) {
+		ssd1306_draw_offset(par_x, par_y, x, y, color);
+		ssd1306_draw_offset(par_x, par_y, y, x, color);
+		ssd1306_draw_offset(par_x, par_y, -y, x, color);
+		ssd1306_draw_offset(par_x, par_y, -x, y, color);
+		ssd1306_draw_offset(par_x, par_y, -x, -y, color);
+		ssd1306_draw_offset(par_x, par_y, -y, -x, color);
+		ssd1306_draw_offset(par_x, par_y, y, -x, color);
+		ssd1306_draw_offset(par_x, par_y, x, -y, color);
+
+		y++;
+		if (err < 0) {
+			err += 2 * y + 1;
+		} else {
+			x--;
+			err += 2 * (y - x) + 1;
+		}
+	}
+}
+
+/* tan(n deg) * 256, n = 0..45 */
+static const uint16_t ssd1306_tan_table[46] = {
+	0, 4, 9, 13, 18, 22, 27, 31, 36, 41, 45, 50, 54, 59, 64, 69,
+	73, 78, 83, 88, 93, 98, 103, 109, 114, 119, 125, 130, 136, 142,
+	148, 154, 160, 166, 173, 179, 186, 193, 200, 207, 215, 223, 231,
+	239, 247, 256,
+};
+
+/* Angle of b / a <= 1 in degrees, 0..45 */
+static uint8_t ssd1306_atan_deg(uint16_t b, uint16_t a)
+{
+	uint16_t t = ((uint32_t)b << 8) / a;
+	uint8_t lo = 0, hi = 45;
+
+	while (lo < hi) {
+		uint8_t mid = (lo + hi + 1) / 2;
+
+		if (ssd1306_tan_table[mid] <= t)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+
+	return lo;
+}
+
+/*
+ * Angle of the point (dx, dy) around the center, in degrees 0..359: 0 is
+ * straight down (+y), 90 is to the right (+x).
+ */
+static uint16_t ssd1306_angle(int16_t dx, int16_t dy)
+{
+	uint16_t ax = (dx < 0) ? -dx : dx;
+	uint16_t ay = (dy < 0) ? -dy : dy;
+	uint16_t a;
+
+	if (!ax && !ay)
+		return 0;
+	a = (ax <= ay) ? ssd1306_atan_deg(ax, ay) :
+			 90 - ssd1306_atan_deg(ay, ax);
+
+	if (dx >= 0)
+		return (dy >= 0) ? a : 180 - a;
+	return (dy < 0) ? 180 + a : (360 - a) % 360;
+}
+
+/* Circle point, if it is within the arc */
+static void ssd1306_arc_point(uint8_t x, uint8_t y, int16_t dx, int16_t dy,
+			      uint16_t start, uint16_t sweep,
+			      oled_color_t color)
+{
+	uint16_t rel = (ssd1306_angle(dx, dy) + 360 - start) % 360;
+
+	if (rel <= sweep)
+		ssd1306_draw_offset(x, y, dx, dy, color);
+}
+
+/**
+ * Draw arc of the circle: midpoint circle points within the angle range.
+ *
+ * Angles are in degrees: 0 is straight down from the center, growing
+ * towards the right side (the same as in the original stm32-ssd1306 lib).
+ *
+ * @param x Center column
+ * @param y Center row
+ * @param radius Circle radius
+ * @param start_angle Where the arc starts
+ * @param sweep Arc length; 360 or more draws the whole circle
+ * @param color Pixel color
+ */
+void ssd1306_draw_arc(uint8_t x, uint8_t y, uint8_t radius,
+		      uint16_t start_angle, uint16_t sweep, oled_color_t color)
+{
+	int16_t cx = radius, cy = 0, err = 1 - radius;
+
+	if (sweep >= 360) {
+		ssd1306_draw_circle(x, y, radius, color);
+		return;
+	}
+	start_angle %= 360;
+
+	while (cx >= cy) {
+		ssd1306_arc_point(x, y, cx, cy, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, cy, cx, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, -cy, cx, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, -cx, cy, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, -cx, -cy, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, -cy, -cx, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, cy, -cx, start_angle, sweep, color);
+		ssd1306_arc_point(x, y, cx, -cy, start_angle, sweep, color);
+
+		cy++;
+		if (err < 0) {
+			err += 2 * cy + 1;
+		} else {
+			cx--;
+			err += 2 * (cy - cx) + 1;
+		}
+	}
+}
+
+/**
+ * Move contents of the rectangle (x1, y1)-(x2, y2) left by n columns.
+ *
+ * Whole bytes are moved where the rectangle covers the full page height,
+ * masked bytes on its top and bottom pages. Rightmost n columns keep their
+ * old contents; the caller draws there.
+ */
+void ssd1306_shift_left(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2,
+			uint8_t n)
+{
+	uint8_t page, last, i, len;
+
+	if (!ssd1306_clip(&x1, &x2, SSD1306_WIDTH) ||
+	    !ssd1306_clip(&y1, &y2, SSD1306_HEIGHT))
+		return;
+	if (!n || n > x2 - x1)
+		return;
+
+	len = x2 - x1 + 1 - n;
+	last = y2 / 8;
+	for (page = y1 / 8; page <= last; page++) {
+		uint8_t *p = &ssd1306_buff[page * SSD1306_WIDTH + x1];
+		uint8_t mask = 0xff;
+
+		if (page == y1 / 8)
+			mask &= 0xff << (y1 % 8);
+		if (page == last)
+			mask &= 0xff >> (7 - y2 % 8);
+
+		if (mask == 0xff) {
+			memmove(p, p + n, len);
+		} else {
+			for (i = 0; i < len; i++)
+				p[i] = (p[i] & ~mask) | (p[i + n] & mask);
+		}
+
+		ssd1306_mark_dirty(page, x1, x1 + len - 1);
+	}
+}
+
+/* Scroll command codes */
+#define SSD1306_SCROLL_H_RIGHT		0x26
+#define SSD1306_SCROLL_H_LEFT		0x27
+#define SSD1306_SCROLL_VH_RIGHT		0x29
+#define SSD1306_SCROLL_VH_LEFT		0x2A
+#define SSD1306_SCROLL_STEP_RIGHT	0x2C
+#define SSD1306_SCROLL_STEP_LEFT	0x2D
+#define SSD1306_SCROLL_STOP		0x2E
+#define SSD1306_SCROLL_START		0x2F
+#define SSD1306_SCROLL_V_AREA		0xA3
+
+/* Pages under continuous scroll; page0 > page1 if scroll is off */
+static uint8_t ssd1306_scroll_page0 = 0xff, ssd1306_scroll_page1;
+
+/**
+ * Start continuous hardware scroll of pages page0..page1 (ticker).
+ *
+ * The controller moves the picture by itself, no data goes over the bus.
+ * Display RAM is not in sync with the framebuffer while scrolling; the
+ * scrolled pages are sent again by the first update after
+ * ssd1306_scroll_stop(). Don't draw into them meanwhile.
+ *
+ * @param page0 First page
+ * @param page1 Last page
+ * @param dir Horizontal direction
+ * @param interval Frames per step, datasheet code 0..7:
+ *                 5, 64, 128, 256, 3, 4, 25, 2 frames
+ * @param voffset Rows per step of vertical scroll (whole screen), 0 for
+ *                horizontal scroll only
+ * @return 0 on success or negative value on error
+ */
+int ssd1306_scroll_start(uint8_t page0, uint8_t page1,
+			 enum ssd1306_scroll_dir dir, uint8_t interval,
+			 uint8_t voffset)
+{
+	uint8_t cmds[13];
+	uint8_t n = 0;
+	int ret;
+
+	if (page0 > page1 || page1 >= SSD1306_PAGES || interval > 7 ||
+	    voffset >= SSD1306_HEIGHT)
+		return -EINVAL;
+
+	/* Setup is only allowed with scroll stopped */
+	cmds[n++] = SSD1306_SCROLL_STOP;
+
+	if (voffset) {
+		cmds[n++] = SSD1306_SCROLL_V_AREA;
+		cmds[n++] = 0;			/* no fixed rows on top */
+		cmds[n++] = SSD1306_HEIGHT;	/* all rows scroll */
+		cmds[n++] = (dir == SSD1306_SCROLL_LEFT) ?
+			    SSD1306_SCROLL_VH_LEFT : SSD1306_SCROLL_VH_RIGHT;
+	} else {
+		cmds[n++] = (dir == SSD1306_SCROLL_LEFT) ?
+			    SSD1306_SCROLL_H_LEFT : SSD1306_SCROLL_H_RIGHT;
+	}
+	cmds[n++] = 0x00;			/* dummy */
+	cmds[n++] = page0;
+	cmds[n++] = interval;
+	cmds[n++] = page1;
+	if (voffset) {
+		cmds[n++] = voffset;
+	} else {
+		cmds[n++] = 0x00;		/* dummy */
+		cmds[n++] = 0xFF;		/* dummy */
+	}
+	cmds[n++] = SSD1306_SCROLL_START;
+
+	ret = ssd1306_write_cmds(cmds, n);
+	if (ret != 0)
+		return ret;
+
+	/* Vertical scroll moves the whole screen */
+	ssd1306_scroll_page0 = voffset ? 0 : page0;
+	ssd1306_scroll_page1 = voffset ? SSD1306_PAGES - 1 : page1;
+
+	return 0;
+}
+
+/**
+ * Stop continuous scroll started by ssd1306_scroll_start().
+ *
+ * Scrolled pages are marked changed, so the next update puts the
+ * framebuffer contents back into display RAM.
+ *
+ * @return 0 on success or negative value on error
+ */
+int ssd1306_scroll_stop(void)
+{
+	uint8_t page;
+	int ret;
+
+	ret = ssd1306_write_cmd(SSD1306_SCROLL_STOP);
+	if (ret != 0)
+		return ret;
+
+	for (page = ssd1306_scroll_page0; page <= ssd1306_scroll_page1; page++)
+		ssd1306_mark_dirty(page, 0, SSD1306_WIDTH - 1);
+	ssd1306_scroll_page0 = 0xff;
+	ssd1306_scroll_page1 = 0;
+
+	return 0;
+}
+
+#if USE_OLED_STEP_SCROLL
+/* Move page bytes of columns x0..x1 by one column in the buffer */
+static void ssd1306_step_buf(uint8_t *buf, uint8_t page, uint8_t x0,
+			     uint8_t x1, enum ssd1306_scroll_dir dir)
+{
+	uint8_t *p = &buf[page * SSD1306_WIDTH + x0];
+
+	if (dir == SSD1306_SCROLL_LEFT)
+		memmove(p, p + 1, x1 - x0);
+	else
+		memmove(p + 1, p, x1 - x0);
+}
+#endif
+
+/**
+ * Scroll columns x0..x1 of pages page0..page1 by one column in display RAM
+ * (content scroll, 0x2C/0x2D), and the framebuffers the same way.
+ *
+ * Content scroll is not in the SSD1306 datasheet: only SSD1306B, SSD1309
+ * and SSD1315 have it, a plain SSD1306 takes the bytes as other commands
+ * and the panel goes out of sync. So it is built only with
+ * OLED_STEP_SCROLL=1 for those controllers; otherwise this returns
+ * -EOPNOTSUPP and the caller shifts the framebuffer instead.
+ *
+ * Only the command goes over the bus instead of the whole region. The
+ * column coming in at the edge keeps its old contents in the framebuffer
+ * and is sent by the next update; the caller draws the new one there.
+ * The controller needs at least 2 frames (~30 ms) between two steps.
+ *
+ * @param page0 First page
+ * @param page1 Last page
+ * @param x0 First column
+ * @param x1 Last column
+ * @param dir Direction
+ * @return 0 on success, -EBUSY if a frame is in flight or continuous
+ *         scroll is on (the caller falls back to redrawing), -EOPNOTSUPP
+ *         if the controller has no content scroll, or other negative
+ *         value on error
+ */
+int ssd1306_scroll_step(uint8_t page0, uint8_t page1, uint8_t x0, uint8_t x1,
+			enum ssd1306_scroll_dir dir)
+{
+#if USE_OLED_STEP_SCROLL
+	const uint8_t cmds[] = {
+		(dir == SSD1306_SCROLL_LEFT) ? SSD1306_SCROLL_STEP_LEFT :
+					       SSD1306_SCROLL_STEP_RIGHT,
+		0x00,		/* dummy */
+		page0,
+		0x01,		/* dummy */
+		page1,
+		x0,
+		x1,
+	};
+	uint8_t page;
+	int ret;
+
+	if (page0 > page1 || page1 >= SSD1306_PAGES || x0 >= x1 ||
+	    x1 >= SSD1306_WIDTH)
+		return -EINVAL;
+
+	/* Both framebuffers must match display RAM outside dirty spans */
+	if (READ_ONCE(ssd1306_flush_left) ||
+	    ssd1306_scroll_page0 <= ssd1306_scroll_page1)
+		return -EBUSY;
+
+	ret = ssd1306_write_cmds(cmds, sizeof(cmds));
+	if (ret != 0)
+		return ret;
+
+	for (page = page0; page <= page1; page++) {
+		struct ssd1306_span *span = &ssd1306_dirty[page];
+
+		ssd1306_step_buf(ssd1306_front, page, x0, x1, dir);
+		ssd1306_step_buf(ssd1306_buff, page, x0, x1, dir);
+
+		/* Changes not sent yet have moved as well */
+		if (span->x0 <= span->x1) {
+			if (span->x0 > 0)
+				span->x0--;
+			if (span->x1 < SSD1306_WIDTH - 1)
+				span->x1++;
+		}
+
+		/* Column coming in is undefined in display RAM */
+		if (dir == SSD1306_SCROLL_LEFT)
+			ssd1306_mark_dirty(page, x1, x1);
+		else
+			ssd1306_mark_dirty(page, x0, x0);
+	}
+
+	return 0;
+#else
+	UNUSED(page0);
+	UNUSED(page1);
+	UNUSED(x0);
+	UNUSED(x1);
+	UNUSED(dir);
+
+	return -EOPNOTSUPP;
+#endif
+}
+
+/**
+ * Copy ready image (display RAM layout) into the framebuffer.
+ *
+ * @param buf Image data; goes from the top left corner
+ * @param len Image length, at most OLED_BUFF_LEN bytes
+ * @return OLED_OK or OLED_ERR if the image doesn't fit
+ */
+oled_err_t ssd1306_fill_buffer(uint8_t* buf, uint16_t len)
+{
+	uint8_t page;
+
+	if (len > OLED_BUFF_LEN)
+		return OLED_ERR;
+
+	memcpy(ssd1306_buff, buf, len);
+	for (page = 0; page * SSD1306_WIDTH < len; page++)
+		ssd1306_mark_dirty(page, 0, SSD1306_WIDTH - 1);
+
+	return OLED_OK;
+}
+
+/* Framebuffer being drawn into (back buffer), in display RAM layout */
+const uint8_t *ssd1306_get_buffer(void)
+{
+	return ssd1306_buff;
+}
+
+/* Last presented frame (front buffer), in display RAM layout */
+const uint8_t *ssd1306_get_frame(void)
+{
+	return ssd1306_front;
+}
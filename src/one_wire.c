@@ -2,6 +2,7 @@
 #include "common.h"
 #include "board.h"
 #include <libopencm3/stm32/gpio.h>
+#include <errno.h>
 #include <stddef.h>
 
 /* 1-wire specific delay timings */
@@ -15,26 +16,47 @@
 #define OW_WRITE_1_PAUSE		50
 #define OW_WRITE_1_TIME			10
 
-/* Write bit on 1-wire interface. Caller must disable interrupts*/
+/*
+ * Interrupts are disabled only for the timed part of a slot: low pulse, and
+ * for read, sampling. Recovery between slots may be stretched by interrupts,
+ * 1-wire allows that.
+ */
+
+/* Write bit on 1-wire interface */
 static void ow_write_bit(struct ow *obj, uint8_t bit)
 {
+	unsigned long flags;
+
+	enter_critical(flags);
 	gpio_clear(obj->port, obj->pin);
 	udelay(bit ? OW_WRITE_1_TIME : OW_WRITE_0_TIME);
 	gpio_set(obj->port, obj->pin);
+	exit_critical(flags);
+
 	if (bit)
 		udelay(OW_WRITE_1_PAUSE);
 }
 
-/* Read bit on 1-wire interface. Caller must disable interrupts */
-static uint16_t ow_read_bit(struct ow *obj)
+/**
+ * Read bit (one read slot). Also tells if DS18B20 finished conversion: it
+ * reads 0 while converting.
+ *
+ * @param obj Structure to store corresponding GPIOs
+ * @return Bit value
+ */
+uint16_t ow_read_bit(struct ow *obj)
 {
+	unsigned long flags;
 	uint16_t bit = 0;
 
+	enter_critical(flags);
 	gpio_clear(obj->port, obj->pin);
 	udelay(OW_READ_INIT_TIME);
 	gpio_set(obj->port, obj->pin);
 	udelay(OW_READ_SAMPLING_TIME);
 	bit = gpio_get(obj->port, obj->pin);
+	exit_critical(flags);
+
 	udelay(OW_READ_PAUSE);
 
 	return ((bit != 0) ? 1 : 0);
@@ -75,15 +97,18 @@ int ow_reset_pulse(struct ow *obj)
 	unsigned long flags;
 	int val;
 
-	enter_critical(flags);
+	/* Reset low is "at least", only presence sampling is timed */
 	gpio_clear(obj->port, obj->pin);
 	udelay(OW_RESET_TIME);
+
+	enter_critical(flags);
 	gpio_set(obj->port, obj->pin);
 	udelay(OW_PRESENCE_WAIT_TIME);
 	val = gpio_get(obj->port, obj->pin);
-	udelay(OW_RESET_TIME);
 	exit_critical(flags);
 
+	udelay(OW_RESET_TIME);
+
 	if (val)
 		return -1;
 
@@ -98,15 +123,12 @@ int ow_reset_pulse(struct ow *obj)
  */
 void ow_write_byte(struct ow *obj, uint8_t byte)
 {
-	unsigned long flags;
 	size_t i;
 
-	enter_critical(flags);
 	for (i = 0; i < 8; i++) {
 		ow_write_bit(obj, byte >> i & 1);
 		udelay(OW_SLOT_WINDOW);
 	}
-	exit_critical(flags);
 }
 
 /**
@@ -117,16 +139,53 @@ void ow_write_byte(struct ow *obj, uint8_t byte)
  */
 int8_t ow_read_byte(struct ow *obj)
 {
-	unsigned long flags;
 	int16_t byte = 0;
 	size_t i;
 
-	enter_critical(flags);
 	for (i = 0; i < 8; i++) {
 		byte |= ow_read_bit(obj) << i;
 		udelay(OW_SLOT_WINDOW);
 	}
-	exit_critical(flags);
 
 	return (int8_t)byte;
 }
+
+/**
+ * Write bytes and read what the bus returns (send 0xff to read a byte).
+ * Bit-banged in place: cb is called before return.
+ *
+ * @param obj Structure to store corresponding GPIOs
+ * @param tx Bytes to send
+ * @param rx Bytes read back, may be NULL or same as tx
+ * @param len Number of bytes, up to OW_XFER_MAX
+ * @param cb Called when done, may be NULL
+ * @param data Passed to cb
+ * @return 0 on success or -EINVAL
+ */
+int ow_xfer_start(struct ow *obj, const uint8_t *tx, uint8_t *rx, uint8_t len,
+		  ow_done_t cb, void *data)
+{
+	uint8_t byte;
+	size_t i, j;
+
+	if (!len || len > OW_XFER_MAX)
+		return -EINVAL;
+
+	for (i = 0; i < len; i++) {
+		byte = 0;
+		for (j = 0; j < 8; j++) {
+			if (tx[i] >> j & 1)
+				byte |= ow_read_bit(obj) << j;	/* 1 slot */
+			else
+				ow_write_bit(obj, 0);
+			udelay(OW_SLOT_WINDOW);
+		}
+		if (rx)
+			rx[i] = byte;
+	}
+
+	if (cb)
+		cb(obj, 0, data);
+
+	return 0;
+}
@@ -0,0 +1,368 @@
+/**
+ * @file
+ *
+ * 1-Wire master on USART in half-duplex mode (make OW_UART=1).
+ *
+ * TX pin is open-drain and the USART hears its own output, with whatever
+ * the slaves pull low on top of it. Reset is one 0xf0 byte at 9600 baud
+ * (520 us low); any echo but 0xf0 means a presence pulse. Bit slots go at
+ * 115200 baud, one UART byte per bit: 0xff writes 1 (start bit is the
+ * 8.7 us low pulse) and reads the bus, 0x00 writes 0 (78 us low). A read
+ * slot echoes 0xff if the slave left the bus high.
+ *
+ * Slot bytes of a whole transaction go out by TX DMA and their echoes come
+ * back in place by RX DMA; RX complete interrupt decodes them and reports.
+ * Timing is done by the USART, so no interrupts are masked at all.
+ */
+
+#include "one_wire.h"
+#include "common.h"
+#include "board.h"
+#include "irq.h"
+
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/usart.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define OW_UART_RESET_BAUD	9600
+#define OW_UART_SLOT_BAUD	115200
+#define OW_UART_RESET		0xf0
+#define OW_UART_BIT_1		0xff
+#define OW_UART_BIT_0		0x00
+/* Timeout for blocking calls, msec; longest transaction is about 11 ms */
+#define OW_UART_TIMEOUT		20
+
+struct ow_uart {
+	struct irq_action dma_action;
+	uint8_t slots[OW_XFER_MAX * 8];	/* one byte per bit, echo in place */
+	uint8_t nslots;
+	uint8_t *rx;
+	struct ow *ow;
+	ow_done_t cb;
+	void *cb_data;
+	volatile bool busy;
+	int status;
+};
+
+static struct ow_uart ow_uart;
+
+/* Take the bus for a transaction */
+static bool ow_uart_claim(void)
+{
+	unsigned long flags;
+	bool ret = false;
+
+	enter_critical(flags);
+	if (!ow_uart.busy) {
+		ow_uart.busy = true;
+		ret = true;
+	}
+	exit_critical(flags);
+
+	return ret;
+}
+
+/* Drop stale received byte and overrun flag */
+static void ow_uart_drain(void)
+{
+	while (USART_SR(OW_USART) & (USART_SR_RXNE | USART_SR_ORE))
+		(void)USART_DR(OW_USART);
+}
+
+static void ow_uart_set_baud(uint32_t baud)
+{
+	while (!usart_get_flag(OW_USART, USART_SR_TC))
+		;
+	usart_disable(OW_USART);
+	usart_set_baudrate(OW_USART, baud);
+	usart_enable(OW_USART);
+}
+
+/* Send filled slots; bus must be claimed */
+static void ow_uart_run(struct ow *obj, uint8_t nslots, uint8_t *rx,
+			ow_done_t cb, void *data)
+{
+	struct ow_uart *ou = &ow_uart;
+
+	ou->ow = obj;
+	ou->nslots = nslots;
+	ou->rx = rx;
+	ou->cb = cb;
+	ou->cb_data = data;
+	ou->status = 0;
+
+	ow_uart_drain();
+
+	dma_set_memory_address(DMA1, OW_DMA_RX_CH, (uint32_t)ou->slots);
+	dma_set_number_of_data(DMA1, OW_DMA_RX_CH, nslots);
+	dma_enable_channel(DMA1, OW_DMA_RX_CH);
+	usart_enable_rx_dma(OW_USART);
+
+	/* TX DMA reads slot n + 1 before RX DMA writes echo of slot n */
+	dma_set_memory_address(DMA1, OW_DMA_TX_CH, (uint32_t)ou->slots);
+	dma_set_number_of_data(DMA1, OW_DMA_TX_CH, nslots);
+	dma_enable_channel(DMA1, OW_DMA_TX_CH);
+	usart_enable_tx_dma(OW_USART);
+}
+
+static void ow_uart_stop_dma(void)
+{
+	dma_disable_channel(DMA1, OW_DMA_RX_CH);
+	dma_disable_channel(DMA1, OW_DMA_TX_CH);
+	usart_disable_rx_dma(OW_USART);
+	usart_disable_tx_dma(OW_USART);
+}
+
+/* RX DMA: echo of the last slot is in, decode bytes and report */
+static irqreturn_t ow_uart_dma_isr(int irq, void *data)
+{
+	struct ow_uart *ou = data;
+	uint8_t byte;
+	size_t i, j;
+
+	UNUSED(irq);
+
+	if (dma_get_interrupt_flag(DMA1, OW_DMA_RX_CH, DMA_TEIF))
+		ou->status = -EIO;
+
+	dma_clear_interrupt_flags(DMA1, OW_DMA_RX_CH,
+				  DMA_TEIF | DMA_TCIF | DMA_GIF);
+	ow_uart_stop_dma();
+
+	if (!ou->busy)
+		return IRQ_NONE;
+
+	if (ou->rx) {
+		for (i = 0; i < ou->nslots / 8; i++) {
+			byte = 0;
+			for (j = 0; j < 8; j++) {
+				if (ou->slots[i * 8 + j] == OW_UART_BIT_1)
+					byte |= BIT(j);
+			}
+			ou->rx[i] = byte;
+		}
+	}
+
+	ou->busy = false;
+	if (ou->cb)
+		ou->cb(ou->ow, ou->status, ou->cb_data);
+
+	return IRQ_HANDLED;
+}
+
+/* Run claimed transaction and wait for it */
+static int ow_uart_run_sync(struct ow *obj, uint8_t nslots, uint8_t *rx)
+{
+	unsigned long flags;
+
+	ow_uart_run(obj, nslots, rx, NULL, NULL);
+	if (wait_event_timeout(!ow_uart.busy, OW_UART_TIMEOUT)) {
+		/* Lost DMA request: give the bus back */
+		enter_critical(flags);
+		ow_uart_stop_dma();
+		ow_uart.busy = false;
+		exit_critical(flags);
+		return -ETIMEDOUT;
+	}
+
+	return ow_uart.status;
+}
+
+/* Fill slots for bytes: LSB first */
+static void ow_uart_fill(const uint8_t *tx, uint8_t len)
+{
+	size_t i, j;
+
+	for (i = 0; i < len; i++) {
+		for (j = 0; j < 8; j++) {
+			ow_uart.slots[i * 8 + j] = (tx[i] & BIT(j)) ?
+						   OW_UART_BIT_1 :
+						   OW_UART_BIT_0;
+		}
+	}
+}
+
+/**
+ * Write bytes and read what the bus returns (send 0xff to read a byte), by
+ * DMA. Returns right away; cb is called from DMA interrupt.
+ *
+ * @param obj 1-wire object
+ * @param tx Bytes to send
+ * @param rx Bytes read back, may be NULL or same as tx
+ * @param len Number of bytes, up to OW_XFER_MAX
+ * @param cb Called when done, may be NULL
+ * @param data Passed to cb
+ * @return 0 on success, -EINVAL on bad length or -EBUSY
+ */
+int ow_xfer_start(struct ow *obj, const uint8_t *tx, uint8_t *rx, uint8_t len,
+		  ow_done_t cb, void *data)
+{
+	if (!len || len > OW_XFER_MAX)
+		return -EINVAL;
+	if (!ow_uart_claim())
+		return -EBUSY;
+
+	ow_uart_fill(tx, len);
+	ow_uart_run(obj, len * 8, rx, cb, data);
+
+	return 0;
+}
+
+/**
+ * Initialize one-wire interface.
+ *
+ * @param obj 1-wire object; pin is fixed by board.h
+ * @return 0 on success or negative code on error
+ */
+int ow_init(struct ow *obj)
+{
+	struct ow_uart *ou = &ow_uart;
+	int ret;
+
+	ou->busy = false;
+
+	usart_set_baudrate(OW_USART, OW_UART_SLOT_BAUD);
+	usart_set_databits(OW_USART, 8);
+	usart_set_stopbits(OW_USART, USART_STOPBITS_1);
+	usart_set_parity(OW_USART, USART_PARITY_NONE);
+	usart_set_mode(OW_USART, USART_MODE_TX_RX);
+	usart_set_flow_control(OW_USART, USART_FLOWCONTROL_NONE);
+	USART_CR3(OW_USART) |= USART_CR3_HDSEL;
+	usart_enable(OW_USART);
+
+	dma_channel_reset(DMA1, OW_DMA_TX_CH);
+	dma_set_peripheral_address(DMA1, OW_DMA_TX_CH,
+				   (uint32_t)&USART_DR(OW_USART));
+	dma_set_read_from_memory(DMA1, OW_DMA_TX_CH);
+	dma_enable_memory_increment_mode(DMA1, OW_DMA_TX_CH);
+	dma_set_peripheral_size(DMA1, OW_DMA_TX_CH, DMA_CCR_PSIZE_8BIT);
+	dma_set_memory_size(DMA1, OW_DMA_TX_CH, DMA_CCR_MSIZE_8BIT);
+	dma_set_priority(DMA1, OW_DMA_TX_CH, DMA_CCR_PL_MEDIUM);
+
+	dma_channel_reset(DMA1, OW_DMA_RX_CH);
+	dma_set_peripheral_address(DMA1, OW_DMA_RX_CH,
+				   (uint32_t)&USART_DR(OW_USART));
+	dma_set_read_from_peripheral(DMA1, OW_DMA_RX_CH);
+	dma_enable_memory_increment_mode(DMA1, OW_DMA_RX_CH);
+	dma_set_peripheral_size(DMA1, OW_DMA_RX_CH, DMA_CCR_PSIZE_8BIT);
+	dma_set_memory_size(DMA1, OW_DMA_RX_CH, DMA_CCR_MSIZE_8BIT);
+	dma_set_priority(DMA1, OW_DMA_RX_CH, DMA_CCR_PL_HIGH);
+	dma_enable_transfer_complete_interrupt(DMA1, OW_DMA_RX_CH);
+	dma_enable_transfer_error_interrupt(DMA1, OW_DMA_RX_CH);
+
+	ou->dma_action.handler = ow_uart_dma_isr;
+	ou->dma_action.irq = OW_DMA_RX_IRQ;
+	ou->dma_action.name = "ow_dma";
+	ou->dma_action.data = ou;
+	ret = irq_request(&ou->dma_action);
+	if (ret)
+		return ret;
+
+	nvic_enable_irq(OW_DMA_RX_IRQ);
+
+	return ow_reset_pulse(obj);
+}
+
+/* Destroy object */
+void ow_exit(struct ow *obj)
+{
+	UNUSED(obj);
+
+	nvic_disable_irq(OW_DMA_RX_IRQ);
+	irq_free(&ow_uart.dma_action);
+	usart_disable(OW_USART);
+}
+
+/**
+ * Reset-presence pulse. Single byte, sent by CPU: about 1 ms of polling
+ * with interrupts enabled.
+ *
+ * @param obj 1-wire object
+ * @return 0 on success, -1 if device doesn't respond or negative error
+ */
+int ow_reset_pulse(struct ow *obj)
+{
+	uint16_t echo;
+	int ret = 0;
+
+	UNUSED(obj);
+
+	if (wait_event_timeout(ow_uart_claim(), OW_UART_TIMEOUT))
+		return -EBUSY;
+
+	ow_uart_set_baud(OW_UART_RESET_BAUD);
+	ow_uart_drain();
+	usart_send(OW_USART, OW_UART_RESET);
+	if (wait_event_timeout(usart_get_flag(OW_USART, USART_SR_RXNE),
+			       OW_UART_TIMEOUT)) {
+		ret = -ETIMEDOUT;
+	} else {
+		echo = usart_recv(OW_USART);
+		if (echo == OW_UART_RESET)
+			ret = -1;
+	}
+	ow_uart_set_baud(OW_UART_SLOT_BAUD);
+
+	ow_uart.busy = false;
+
+	return ret;
+}
+
+/**
+ * Write byte of data.
+ *
+ * @param obj 1-wire object
+ * @param byte Data to be written
+ */
+void ow_write_byte(struct ow *obj, uint8_t byte)
+{
+	if (wait_event_timeout(ow_uart_claim(), OW_UART_TIMEOUT))
+		return;
+
+	ow_uart_fill(&byte, 1);
+	ow_uart_run_sync(obj, 8, NULL);
+}
+
+/**
+ * Read byte of data.
+ *
+ * @param obj 1-wire object
+ * @return Byte read, 0xff on error (released bus)
+ */
+int8_t ow_read_byte(struct ow *obj)
+{
+	const uint8_t ones = 0xff;
+	uint8_t byte = 0xff;
+
+	if (wait_event_timeout(ow_uart_claim(), OW_UART_TIMEOUT))
+		return (int8_t)byte;
+
+	ow_uart_fill(&ones, 1);
+	if (ow_uart_run_sync(obj, 8, &byte))
+		byte = 0xff;
+
+	return (int8_t)byte;
+}
+
+/**
+ * Read bit (one read slot). Also tells if DS18B20 finished conversion: it
+ * reads 0 while converting.
+ *
+ * @param obj 1-wire object
+ * @return Bit value; 1 on error (released bus)
+ */
+uint16_t ow_read_bit(struct ow *obj)
+{
+	if (wait_event_timeout(ow_uart_claim(), OW_UART_TIMEOUT))
+		return 1;
+
+	ow_uart.slots[0] = OW_UART_BIT_1;
+	if (ow_uart_run_sync(obj, 1, NULL))
+		return 1;
+
+	return ow_uart.slots[0] == OW_UART_BIT_1;
+}
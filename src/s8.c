@@ -0,0 +1,173 @@
+/**
+ * @file
+ *
+ * SenseAir S8 CO2 sensor driver (Modbus RTU over serial port).
+ *
+ * Registers we need are described in the register map below. On init the map
+ * is merged into the fewest possible read transactions: registers with the same
+ * function code and poll rate go into one request if the gap between them is
+ * small (reading a few unused registers is cheaper than one more request with
+ * its own turnaround). Registers that almost never change (IDs, firmware
+ * version, ABC period) are polled only every S8_SLOW_RATE cycle, so a regular
+ * poll costs a single transaction.
+ */
+
+#include "s8.h"
+#include "modbus.h"
+#include "common.h"
+#include <errno.h>
+#include <stddef.h>
+
+#define S8_MERGE_GAP		3	/* max unused registers in a batch */
+
+/* Register description */
+struct s8_reg_desc {
+	uint8_t fc;		/* function code to read it with */
+	uint8_t rate;		/* poll divider */
+	uint16_t addr;		/* register address (0-based) */
+	uint8_t offset;		/* field offset in struct s8_sample */
+};
+
+#define S8_REG(_fc, _addr, _rate, _field) {				\
+	.fc = (_fc),							\
+	.rate = (_rate),						\
+	.addr = (_addr),						\
+	.offset = offsetof(struct s8_sample, _field),			\
+}
+
+/* See "Modbus on Senseair S8" (TDE2067) for the register map */
+static const struct s8_reg_desc s8_map[S8_REG_NR] = {
+	[S8_METER_STATUS]  = S8_REG(MODBUS_FC_READ_INPUT, 0, 1, meter_status),
+	[S8_ALARM_STATUS]  = S8_REG(MODBUS_FC_READ_INPUT, 1, 1, alarm_status),
+	[S8_OUTPUT_STATUS] = S8_REG(MODBUS_FC_READ_INPUT, 2, 1, output_status),
+	[S8_SPACE_CO2]     = S8_REG(MODBUS_FC_READ_INPUT, 3, 1, co2),
+	[S8_TYPE_ID_HI]    = S8_REG(MODBUS_FC_READ_INPUT, 25, S8_SLOW_RATE,
+				    type_id_hi),
+	[S8_TYPE_ID_LO]    = S8_REG(MODBUS_FC_READ_INPUT, 26, S8_SLOW_RATE,
+				    type_id_lo),
+	[S8_MAP_VERSION]   = S8_REG(MODBUS_FC_READ_INPUT, 27, S8_SLOW_RATE,
+				    map_version),
+	[S8_FW_VERSION]    = S8_REG(MODBUS_FC_READ_INPUT, 28, S8_SLOW_RATE,
+				    fw_version),
+	[S8_ABC_PERIOD]    = S8_REG(MODBUS_FC_READ_HOLDING, 31, S8_SLOW_RATE,
+				    abc_period),
+};
+
+/* Read transactions the register map is merged into */
+static struct s8_batch s8_batches[S8_BATCH_MAX];
+static uint8_t s8_batch_nr;
+
+/**
+ * Try to add register to existing batch.
+ *
+ * @return 0 if register was merged into batch or -1 otherwise
+ */
+static int s8_batch_merge(struct s8_batch *b, const struct s8_reg_desc *reg)
+{
+	uint16_t start = b->start;
+	uint16_t end = b->start + b->count;	/* one past last register */
+	uint16_t gap;
+
+	if (b->fc != reg->fc || b->rate != reg->rate)
+		return -1;
+
+	if (reg->addr >= end) {
+		gap = reg->addr - end;
+		end = reg->addr + 1;
+	} else if (reg->addr < start) {
+		gap = start - reg->addr - 1;
+		start = reg->addr;
+	} else {
+		return 0;		/* already inside */
+	}
+
+	if (gap > S8_MERGE_GAP || end - start > S8_BATCH_REGS_MAX)
+		return -1;
+
+	b->start = start;
+	b->count = end - start;
+	return 0;
+}
+
+/**
+ * Merge the register map into read transactions.
+ *
+ * @return 0 on success or negative value on error
+ */
+int s8_init(void)
+{
+	size_t i, j;
+
+	s8_batch_nr = 0;
+
+	for (i = 0; i < S8_REG_NR; ++i) {
+		const struct s8_reg_desc *reg = &s8_map[i];
+
+		for (j = 0; j < s8_batch_nr; ++j) {
+			if (s8_batch_merge(&s8_batches[j], reg) == 0)
+				break;
+		}
+		if (j < s8_batch_nr)
+			continue;
+
+		if (s8_batch_nr == S8_BATCH_MAX)
+			return -ENOSPC;
+
+		s8_batches[s8_batch_nr].fc = reg->fc;
+		s8_batches[s8_batch_nr].rate = reg->rate;
+		s8_batches[s8_batch_nr].start = reg->addr;
+		s8_batches[s8_batch_nr].count = 1;
+		s8_batch_nr++;
+	}
+
+	return 0;
+}
+
+/**
+ * Get next read transaction due in current poll cycle.
+ *
+ * Call it until it returns NULL, which means the poll cycle is over (the next
+ * call starts a new cycle).
+ *
+ * @param poller Poll sequence state of the sensor
+ * @return Batch to read or NULL at the end of the poll cycle
+ */
+const struct s8_batch *s8_next_batch(struct s8_poller *poller)
+{
+	while (poller->next < s8_batch_nr) {
+		const struct s8_batch *b = &s8_batches[poller->next++];
+
+		if (poller->cycle % b->rate == 0)
+			return b;
+	}
+
+	poller->next = 0;
+	poller->cycle++;
+	return NULL;
+}
+
+/**
+ * Decode registers of read transaction into sample.
+ *
+ * @param batch Transaction the data was read with
+ * @param data Registers data from reply frame (big-endian)
+ * @param[out] sample Sample to update; "valid" mask is updated too
+ */
+void s8_decode(const struct s8_batch *batch, const uint8_t *data,
+	       struct s8_sample *sample)
+{
+	size_t i;
+
+	for (i = 0; i < S8_REG_NR; ++i) {
+		const struct s8_reg_desc *reg = &s8_map[i];
+		uint16_t *field;
+
+		if (reg->fc != batch->fc || reg->addr < batch->start ||
+		    reg->addr >= batch->start + batch->count)
+			continue;
+
+		field = (uint16_t *)((uint8_t *)sample + reg->offset);
+		*field = modbus_get_reg(data, reg->addr - batch->start);
+		sample->valid |= BIT(i);
+	}
+}
@@ -1,9 +1,11 @@
 /**
- * 
+ *
  * @file
  *
  *	File contain USART settings and FIFO
  *
+ *	Each USART (port) has its own RX/TX FIFOs and IRQ handler, so several
+ *	ports can be used at once; port is selected by USART base address.
  *
  */
 #include "../inc/errors.h"
@@ -11,6 +13,7 @@
 #include "../inc/common.h"
 #include "../inc/fifo.h"
 #include "../inc/irq.h"
+#include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/usart.h>
 #include <libopencm3/cm3/nvic.h>
 #include "libprintf/printf.h"
@@ -18,157 +21,313 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <errno.h>
+#include <string.h>
+
+#define SERIAL_PORTS 3 // USART1..USART3
+
+struct serial_port {
+	struct serial_device dev;
+	struct irq_action action;
+	fifo_t rx_fifo;
+	fifo_t tx_fifo;
+	uint8_t rx_buff[FIFO_SIZE];
+	uint8_t tx_buff[FIFO_SIZE];
+	const uint8_t *tx_frame;	/* frame being sent bypassing TX FIFO */
+	volatile uint16_t tx_frame_len;	/* bytes of tx_frame left to send */
+	struct serial_stats stats;
+};
+
+static struct serial_port serial_ports[SERIAL_PORTS];
+
+static const uint8_t serial_irqs[SERIAL_PORTS] = {
+	NVIC_USART1_IRQ,
+	NVIC_USART2_IRQ,
+	NVIC_USART3_IRQ,
+};
+
+static const char * const serial_irq_names[SERIAL_PORTS] = {
+	"usart1_isr",
+	"usart2_isr",
+	"usart3_isr",
+};
+
+/* Get port object by USART base address */
+static struct serial_port *serial_get_port(uint32_t usart)
+{
+	switch (usart) {
+	case USART1:
+		return &serial_ports[0];
+	case USART2:
+		return &serial_ports[1];
+	case USART3:
+		return &serial_ports[2];
+	default:
+		return NULL;
+	}
+}
+
+/* Take received byte from DR into RX FIFO; status is SR read with it */
+static void serial_rx_byte(struct serial_port *port, int16_t status)
+{
+	struct serial_device *obj = &port->dev;
+	int8_t rx_last_error = 0;
+	uint8_t rx_data;
 
-/* singleton object */
-uint32_t serial_usart;
+	// parse incoming byte
+	rx_data = usart_recv(obj->uart);
+
+	/*
+	 * Check flags of the USART NE, ORE, FE, PE; several of them
+	 * can be set for the same byte, so count each one.
+	 */
+	if (status & USART_SR_NE) {
+		rx_last_error |= EUSART_NOISE;
+		port->stats.noise++;
+	}
+	if (status & USART_SR_ORE) {
+		rx_last_error |= EUSART_OVERRUN;
+		port->stats.overrun++;
+	}
+	if (status & USART_SR_FE) {
+		rx_last_error |= EUSART_FRAME;
+		port->stats.frame++;
+	}
+	if (status & USART_SR_PE) {
+		rx_last_error |= EUSART_PARITY;
+		port->stats.parity++;
+	}
 
-#define USART_IRQS 1 // Number of IRQs
+	port->rx_fifo.last_error = rx_last_error;
+	port->stats.rx_bytes++;
+
+	// Put new data in to RX FIFO buffer
+	if (fifo_put(&port->rx_fifo, &rx_data, 1) != EOK) {
+		port->stats.rx_drops++;
+	} else {
+		fifo_len_t used = fifo_used(&port->rx_fifo);
+
+		if (used > port->stats.rx_hwm)
+			port->stats.rx_hwm = used;
+	}
+
+	if (obj->rx_cb)
+		obj->rx_cb(rx_data, obj->cb_data);
+}
 
 /**
- * IRQ handler for USART1
+ * IRQ handler for USART ports
  *
  *
  * **/
-static irqreturn_t usart1_isr_handler(int irq, void *data)
+static irqreturn_t serial_isr_handler(int irq, void *data)
 {
-//TODO: struct rtc *obj = (struct rtc *)(data);
+	struct serial_port *port = (struct serial_port *)(data);
+	struct serial_device *obj = &port->dev;
+	uint32_t usart = obj->uart;
 
 	UNUSED(irq);
-	UNUSED(data);
 
 	int16_t status;
-	uint8_t rx_data;
 	uint8_t tx_data;
 	int8_t tx_data_len;
-	int8_t rx_last_error = 0;
 
-	status = USART_SR(serial_usart);
-	rx_last_error = 0;
+	status = USART_SR(usart);
 
 	// Check if we were called because of RXNE
-	if(status & USART_SR_RXNE){
-		// parse incoming byte
-		rx_data = usart_recv(serial_usart);
-
-//		printf("From RX ISR data = %x \n ", rx_data);
-		// Check flag of the USART NE, ORE, FE, PE
-		if (status & USART_SR_NE) {
-			rx_last_error |= EUSART_NOISE;
-		} else if (status & USART_SR_ORE) {
-			rx_last_error |= EUSART_OVERRUN;
-		} else if (status & USART_SR_FE) {
-			rx_last_error |= EUSART_FRAME;
-		} else if( status & USART_SR_PE) {
-			rx_last_error |= EUSART_PARITY;
-		}
+	if (status & USART_SR_RXNE)
+		serial_rx_byte(port, status);
 
-		rx_fifo.last_error = rx_last_error;
-			// Put new data in to RX FIFO buffer
-			// TODO add error checks of FIFO 
-		fifo_put(&rx_fifo, &rx_data, 1);
-	}
 	// Check if we were called because of TXE -> send next byte in buffer
-	if((USART_CR1(serial_usart) & USART_CR1_TXEIE) && (status & USART_SR_TXE)){
-
-		// Get new data from TX FIFO
-		tx_data_len  = fifo_get(&tx_fifo, &tx_data, 1);
-	
-		if (tx_data_len > 0) {
-
-			usart_send(serial_usart, tx_data);
-		//	printf("From TX ISR data = %x \n ", tx_data);
+	if((USART_CR1(usart) & USART_CR1_TXEIE) && (status & USART_SR_TXE)){
 
+		// Frame passed by pointer goes first, then TX FIFO
+		if (port->tx_frame_len) {
+			usart_send(usart, *port->tx_frame++);
+			port->tx_frame_len--;
+			tx_data_len = 1;
 		} else {
+			tx_data_len = fifo_get(&port->tx_fifo, &tx_data, 1);
+			if (tx_data_len > 0)
+				usart_send(usart, tx_data);
+		}
+		if (tx_data_len > 0)
+			port->stats.tx_bytes++;
+
+		if (tx_data_len <= 0) {
 
-			usart_disable_tx_interrupt(serial_usart);
+			usart_disable_tx_interrupt(usart);
+			/* Wait for the last byte to leave the line */
+			if (obj->de_port || obj->tc_cb)
+				USART_CR1(usart) |= USART_CR1_TCIE;
 
 		}
 	}
 
+	// Transmission complete: release RS-485 driver, so slave can reply
+	if ((USART_CR1(usart) & USART_CR1_TCIE) && (status & USART_SR_TC)) {
+		USART_CR1(usart) &= ~USART_CR1_TCIE;
+		/* rc_w0 flags: write, not read-modify-write, not to lose RXNE */
+		USART_SR(usart) = ~USART_SR_TC;
+
+		if (obj->de_port)
+			gpio_clear(obj->de_port, obj->de_pin);
+		if (obj->tc_cb)
+			obj->tc_cb(obj->cb_data);
+	}
+
+	// Line went idle after reception: end of frame for framed protocols
+	if ((USART_CR1(usart) & USART_CR1_IDLEIE) && (status & USART_SR_IDLE)) {
+		/*
+		 * Reading DR clears IDLE (SR already read above); a byte that
+		 * came after SR was sampled goes to RX FIFO, not lost.
+		 */
+		status = USART_SR(usart);
+		if (status & USART_SR_RXNE)
+			serial_rx_byte(port, status);
+		else
+			(void)USART_DR(usart);
+		obj->idle_cb(obj->cb_data);
+	}
+
 	return IRQ_HANDLED;
 }
 
-//	Structure where we define descriotion od USART IRQs
-static struct irq_action usart_irq_act[USART_IRQS] = {
-	{
-		.handler = usart1_isr_handler,
-		.irq = NVIC_USART1_IRQ,
-		.name = "usart1_isr",
-	},
-/*	{
-		.handler = usart2_isr_handler,
-		.irq = NVIC_USART2_IRQ,
-		.name = "usart2_isr,",
-	}*/
-};
+/* Start transmission of whatever is queued on the port */
+static void serial_start_tx(struct serial_port *port)
+{
+	/* Take the RS-485 bus; released in ISR on transmission complete */
+	if (port->dev.de_port)
+		gpio_set(port->dev.de_port, port->dev.de_pin);
 
+	usart_enable_tx_interrupt(port->dev.uart);
+}
 
 int serial_init(struct serial_device *obj)
 {
 	int ret;
-	unsigned long flags;
 	err_t fifo_err = EOK;
+	struct serial_port *port;
+	uint32_t usart = obj->uart;
+	int idx;
+
+	port = serial_get_port(usart);
+	if (!port) {
+		printf("Unknown USART\n");
+		return -EINVAL;
+	}
+	idx = port - serial_ports;
 
-	serial_usart = obj->uart;
+	port->dev = *obj;
+	port->tx_frame_len = 0;
+	memset(&port->stats, 0, sizeof(port->stats));
 
 	/* Initialize FIFOs for Rx and Tx */
-	fifo_err = fifo_init(&rx_fifo, rx_buff, FIFO_SIZE);
+	fifo_err = fifo_init(&port->rx_fifo, port->rx_buff, FIFO_SIZE);
 	if (fifo_err != EOK) {
 		printf("Can't init RX FIFO \n");
 	}
 
-	fifo_err = fifo_init(&tx_fifo, tx_buff, FIFO_SIZE);
-   	if (fifo_err != EOK) {
+	fifo_err = fifo_init(&port->tx_fifo, port->tx_buff, FIFO_SIZE);
+   	if (fifo_err != EOK) {
 		printf("Can't init TX FIFO \n");
 	}
 
-	/* Register interrupt handlers */
-	int i;
-    for (i = 0; i < USART_IRQS; i++) {
-		usart_irq_act[i].data = (void *)obj; // PUT FIFO here
-		ret = irq_request(&usart_irq_act[i]);
-		if (ret) {
-            printf("Unable request USART IRQ\n");
-			return ret;
-        }
+	/* Register interrupt handler */
+	port->action.handler = serial_isr_handler;
+	port->action.irq = serial_irqs[idx];
+	port->action.name = serial_irq_names[idx];
+	port->action.data = (void *)port;
+	ret = irq_request(&port->action);
+	if (ret) {
+		printf("Unable request USART IRQ\n");
+		return ret;
 	}
 
-	nvic_enable_irq(NVIC_USART1_IRQ);
-	usart_set_baudrate(serial_usart, obj->baud);
-	usart_set_databits(serial_usart, obj->bits);
-	usart_set_stopbits(serial_usart, obj->stopbits);
-	usart_set_parity(serial_usart, obj->parity);
-	usart_set_mode(serial_usart, obj->mode);
-	usart_set_flow_control(serial_usart, obj->flow_control);
-	usart_enable_rx_interrupt(serial_usart);
+	nvic_enable_irq(serial_irqs[idx]);
+	usart_set_baudrate(usart, obj->baud);
+	usart_set_databits(usart, obj->bits);
+	usart_set_stopbits(usart, obj->stopbits);
+	usart_set_parity(usart, obj->parity);
+	usart_set_mode(usart, obj->mode);
+	usart_set_flow_control(usart, obj->flow_control);
+	usart_enable_rx_interrupt(usart);
+	if (obj->idle_cb)
+		USART_CR1(usart) |= USART_CR1_IDLEIE;
+
+	/* RS-485 transceiver listens by default */
+	if (obj->de_port)
+		gpio_clear(obj->de_port, obj->de_pin);
 
-	usart_enable(serial_usart);
+	usart_enable(usart);
 
 	return 0;
 }
 
-int serial_send_fifo(uint32_t serial_usart, uint8_t *buff, fifo_len_t len)
+int serial_send_fifo(uint32_t usart, uint8_t *buff, fifo_len_t len)
 {
-
+	struct serial_port *port = serial_get_port(usart);
 	err_t fifo_err = EOK;
+	fifo_len_t used;
 
-	fifo_err = fifo_put(&tx_fifo, buff, len);
+	if (!port)
+		return -1;
+
+	fifo_err = fifo_put(&port->tx_fifo, buff, len);
 	if (fifo_err != EOK) {
+		port->stats.tx_drops += len;
 		printf("Unnable to put in to tx_fifo \n");
 		return -1;
 	}
 
-	usart_enable_tx_interrupt(serial_usart);
+	used = fifo_used(&port->tx_fifo);
+	if (used > port->stats.tx_hwm)
+		port->stats.tx_hwm = used;
+
+	serial_start_tx(port);
 
 	return len;
 }
 
+/**
+ * Send frame directly from caller buffer, without copying it into TX FIFO.
+ *
+ * Can be called from ISR. Use tc_cb to know when the buffer is free again.
+ *
+ * @param usart USART base address
+ * @param buff Frame to send; must stay untouched until transmission completes
+ * @param len Frame length, in bytes
+ * @return len on success or negative value on error
+ */
+int serial_send_frame(uint32_t usart, const uint8_t *buff, uint16_t len)
+{
+	struct serial_port *port = serial_get_port(usart);
+
+	if (!port)
+		return -EINVAL;
+	if (port->tx_frame_len)
+		return -EBUSY;
+
+	port->tx_frame = buff;
+	port->tx_frame_len = len;
 
-int serial_receive_fifo(uint32_t serial_usart, uint8_t *buff, fifo_len_t len)
+	serial_start_tx(port);
+
+	return len;
+}
+
+int serial_receive_fifo(uint32_t usart, uint8_t *buff, fifo_len_t len)
 {
+	struct serial_port *port = serial_get_port(usart);
 	int32_t rcv_len;
-	rcv_len = fifo_get(&rx_fifo, buff, len);
 
+	if (!port)
+		return -1;
+
+	rcv_len = fifo_get(&port->rx_fifo, buff, len);
+
+	/* Nothing received yet is not an error */
+	if (rcv_len == EEMPTY)
+		return 0;
 	if (0 > rcv_len) {
 		printf("Unnable to get data from rx_fifo\n");
 		return -1;
@@ -176,8 +335,91 @@ int serial_receive_fifo(uint32_t serial_usart, uint8_t *buff, fifo_len_t len)
 	return rcv_len;
 }
 
-void serial_exit(void)
+/**
+ * Check if frame passed to serial_send_frame() is still being sent, i.e.
+ * its buffer can't be touched yet.
+ *
+ * @param usart USART base address
+ * @return true if busy
+ */
+bool serial_frame_busy(uint32_t usart)
+{
+	struct serial_port *port = serial_get_port(usart);
+
+	return port && port->tx_frame_len;
+}
+
+/**
+ * Take consistent snapshot of port counters.
+ *
+ * @param usart USART base address
+ * @param[out] stats Counters copy
+ * @return 0 on success or negative value on error
+ */
+int serial_get_stats(uint32_t usart, struct serial_stats *stats)
+{
+	struct serial_port *port = serial_get_port(usart);
+	unsigned long flags;
+
+	if (!port)
+		return -EINVAL;
+
+	enter_critical(flags);
+	*stats = port->stats;
+	exit_critical(flags);
+
+	return 0;
+}
+
+/**
+ * Get free space in port TX FIFO, e.g. to send optional data only when it
+ * does not hold up anything else.
+ *
+ * @param usart USART base address
+ * @return Free bytes; 0 for unknown port
+ */
+fifo_len_t serial_get_tx_free(uint32_t usart)
 {
-	usart_disable(serial_usart);
-	serial_usart = 0;
+	struct serial_port *port = serial_get_port(usart);
+	fifo_len_t used;
+	unsigned long flags;
+
+	if (!port)
+		return 0;
+
+	enter_critical(flags);
+	used = fifo_used(&port->tx_fifo);
+	exit_critical(flags);
+
+	return FIFO_SIZE - used;
+}
+
+/**
+ * Zero port counters, e.g. to start a new measurement window.
+ *
+ * @param usart USART base address
+ */
+void serial_reset_stats(uint32_t usart)
+{
+	struct serial_port *port = serial_get_port(usart);
+	unsigned long flags;
+
+	if (!port)
+		return;
+
+	enter_critical(flags);
+	memset(&port->stats, 0, sizeof(port->stats));
+	exit_critical(flags);
+}
+
+void serial_exit(uint32_t usart)
+{
+	struct serial_port *port = serial_get_port(usart);
+
+	if (!port)
+		return;
+
+	usart_disable(usart);
+	nvic_disable_irq(port->action.irq);
+	irq_free(&port->action);
 }
@@ -400,14 +400,34 @@ static const uint16_t font6x8 [] = {
 #endif
 
 #ifdef SSD1306_INCLUDE_FONT_6x8
-font_def_t font_6x8 = {6,8,font6x8};
+font_def_t font_6x8 = {
+	.font_width = 6,
+	.font_height = 8,
+	.data = font6x8,
+	.pages = font6x8_pages,
+};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_7x10
-font_def_t font_7x10 = {7,10,font7x10};
+font_def_t font_7x10 = {
+	.font_width = 7,
+	.font_height = 10,
+	.data = font7x10,
+	.pages = font7x10_pages,
+};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_11x18
-font_def_t font_11x18 = {11,18,font11x18};
+font_def_t font_11x18 = {
+	.font_width = 11,
+	.font_height = 18,
+	.data = font11x18,
+	.pages = font11x18_pages,
+};
 #endif
 #ifdef SSD1306_INCLUDE_FONT_16x26
-font_def_t font_16x26 = {16,26,font16x26};
+font_def_t font_16x26 = {
+	.font_width = 16,
+	.font_height = 26,
+	.data = font16x26,
+	.pages = font16x26_pages,
+};
 #endif
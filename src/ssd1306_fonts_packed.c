@@ -0,0 +1,198 @@
+/* Generated by tools/font_compiler.py, do not edit */
+
+#include "../inc/ssd1306_fonts.h"
+
+/* ASCII 32..126: 783 bytes of glyphs (RLE), unpacked 855 */
+static const uint8_t font_7x10_glyphs[] = {
+	0xff, 0xff, 0x0a,	/* sp */
+	0xff, 0x60, 0x11, 0xff, 0x02,	/* ! */
+	0x5f, 0xf3, 0x32, 0xcf,	/* " */
+	0x1c, 0x41, 0x42, 0x11, 0x16, 0x12, 0x16, 0x41, 0x42, 0x11, 0x0e,	/* # */
+	0x2b, 0x22, 0x13, 0x12, 0x13, 0x92, 0x11, 0x12, 0x13, 0x13, 0x32, 0x0d,	/* $ */
+	0x2b, 0x12, 0x14, 0x22, 0x36, 0x21, 0x15, 0x11, 0x12, 0x13, 0x23, 0x0d,	/* % */
+	0x0f, 0x42, 0x12, 0x21, 0x21, 0x21, 0x22, 0x31, 0x22, 0x72, 0x21, 0xc1,	/* & */
+	0xff, 0x30, 0xff, 0x07,	/* ' */
+	0x7f, 0x36, 0x61, 0x11, 0x81, 0xf1, 0x05,	/* ( */
+	0x5f, 0x81, 0x11, 0x61, 0x31, 0xf6, 0x07,	/* ) */
+	0x6f, 0x11, 0x61, 0x83, 0x11, 0xf1, 0x0b,	/* * */
+	0x1e, 0x19, 0x57, 0x17, 0x19, 0x0f,	/* + */
+	0xff, 0x37, 0xff, 0x00,	/* , */
+	0xaf, 0x91, 0x91, 0xf1, 0x09,	/* - */
+	0xff, 0x17, 0xff, 0x02,	/* . */
+	0xbf, 0x42, 0x44, 0xf2, 0x0d,	/* / */
+	0x6b, 0x13, 0x16, 0x12, 0x12, 0x13, 0x12, 0x16, 0x63, 0x0d,	/* 0 */
+	0x1c, 0x18, 0x88, 0xff, 0x02,	/* 1 */
+	0x2b, 0x14, 0x12, 0x25, 0x12, 0x14, 0x11, 0x12, 0x13, 0x12, 0x33, 0x13,	/* 2 */
+	0x0c,
+	0x1b, 0x14, 0x13, 0x16, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x23, 0x31,	/* 3 */
+	0x0d,
+	0x2e, 0x26, 0x11, 0x15, 0x13, 0x84, 0x17, 0x0e,	/* 4 */
+	0x4a, 0x12, 0x13, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12,	/* 5 */
+	0x33, 0x0d,
+	0x6b, 0x13, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x13, 0x32,	/* 6 */
+	0x0d,
+	0x1a, 0x19, 0x34, 0x12, 0x22, 0x15, 0x11, 0x27, 0x3f,	/* 7 */
+	0x2b, 0x31, 0x13, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x23,	/* 8 */
+	0x31, 0x0d,
+	0x3b, 0x12, 0x13, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x63,	/* 9 */
+	0x0d,
+	0xff, 0x12, 0x14, 0xff, 0x02,	/* : */
+	0xff, 0x13, 0x33, 0xff, 0x00,	/* ; */
+	0x1e, 0x18, 0x11, 0x17, 0x11, 0x16, 0x13, 0x15, 0x13, 0x0d,	/* < */
+	0x1d, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x17, 0x11, 0x0e,	/* = */
+	0x1c, 0x13, 0x15, 0x13, 0x16, 0x11, 0x17, 0x11, 0x18, 0x0f,	/* > */
+	0x1b, 0x18, 0x19, 0x23, 0x11, 0x12, 0x12, 0x27, 0x2f,	/* ? */
+	0x6b, 0x13, 0x16, 0x12, 0x22, 0x12, 0x12, 0x11, 0x11, 0x12, 0x43, 0x0f,	/* @ */
+	0x0f, 0x33, 0x45, 0x41, 0x51, 0x95, 0xc3,	/* A */
+	0x8a, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x23, 0x31,	/* B */
+	0x0d,
+	0x6b, 0x13, 0x16, 0x12, 0x16, 0x12, 0x16, 0x13, 0x14, 0x0d,	/* C */
+	0x8a, 0x12, 0x16, 0x12, 0x16, 0x13, 0x14, 0x45, 0x0e,	/* D */
+	0x8a, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12,	/* E */
+	0x13, 0x0c,
+	0x8a, 0x12, 0x12, 0x16, 0x12, 0x16, 0x12, 0x16, 0x4f,	/* F */
+	0x6b, 0x13, 0x16, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x13, 0x32, 0x0d,	/* G */
+	0x8a, 0x15, 0x19, 0x19, 0x86, 0x0c,	/* H */
+	0x5f, 0x61, 0x21, 0x28, 0x61, 0xf1, 0x07,	/* I */
+	0x1f, 0xa1, 0x91, 0x91, 0x21, 0xd7,	/* J */
+	0x8a, 0x15, 0x18, 0x11, 0x16, 0x23, 0x13, 0x16, 0x0c,	/* K */
+	0x8a, 0x19, 0x19, 0x19, 0x19, 0x0c,	/* L */
+	0x8a, 0x23, 0x1a, 0x27, 0x87, 0x0c,	/* M */
+	0x8a, 0x23, 0x2a, 0x2a, 0x83, 0x0c,	/* N */
+	0x6b, 0x13, 0x16, 0x12, 0x16, 0x12, 0x16, 0x63, 0x0d,	/* O */
+	0x8a, 0x12, 0x13, 0x15, 0x13, 0x15, 0x13, 0x36, 0x1f,	/* P */
+	0x6b, 0x13, 0x16, 0x12, 0x25, 0x12, 0x16, 0x63, 0x11, 0x0b,	/* Q */
+	0x8a, 0x12, 0x13, 0x15, 0x13, 0x15, 0x33, 0x34, 0x13, 0x0c,	/* R */
+	0x2b, 0x13, 0x13, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x13, 0x12, 0x13,	/* S */
+	0x23, 0x0d,
+	0x1a, 0x19, 0x89, 0x12, 0x19, 0x4f,	/* T */
+	0x7a, 0x1a, 0x19, 0x19, 0x72, 0x0d,	/* U */
+	0x3a, 0x3a, 0x2a, 0x35, 0x34, 0x2f,	/* V */
+	0x6a, 0x39, 0x34, 0x3a, 0x62, 0x0e,	/* W */
+	0x1a, 0x16, 0x23, 0x22, 0x26, 0x26, 0x22, 0x13, 0x16, 0x0c,	/* X */
+	0x2a, 0x2a, 0x4a, 0x24, 0x26, 0x3f,	/* Y */
+	0x1a, 0x25, 0x12, 0x14, 0x11, 0x12, 0x22, 0x12, 0x12, 0x11, 0x14, 0x22,	/* Z */
+	0x15, 0x0c,
+	0xff, 0xb0, 0x18, 0x5f,	/* [ */
+	0x5f, 0xa2, 0xa4, 0xf2, 0x07,	/* \ */
+	0x5f, 0x81, 0xfb, 0x0f,	/* ] */
+	0x1d, 0x27, 0x17, 0x2a, 0x1a, 0x1f,	/* ^ */
+	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,	/* _ */
+	0x5f, 0xa1, 0xf1, 0x8f,	/* ` */
+	0x1d, 0x21, 0x15, 0x11, 0x12, 0x14, 0x11, 0x12, 0x14, 0x11, 0x11, 0x56,	/* a */
+	0x0c,
+	0x8a, 0x15, 0x12, 0x15, 0x14, 0x14, 0x14, 0x45, 0x0d,	/* b */
+	0x4d, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x12, 0x0d,	/* c */
+	0x4d, 0x15, 0x14, 0x14, 0x14, 0x15, 0x12, 0x83, 0x0c,	/* d */
+	0x4d, 0x15, 0x11, 0x12, 0x14, 0x11, 0x12, 0x14, 0x11, 0x12, 0x25, 0x11,	/* e */
+	0x0d,
+	0x1c, 0x19, 0x78, 0x12, 0x11, 0x17, 0x11, 0x2f,	/* f */
+	0x4d, 0x12, 0x12, 0x14, 0x11, 0x12, 0x14, 0x11, 0x13, 0x12, 0x12, 0x72,	/* g */
+	0x0b,
+	0x8a, 0x15, 0x18, 0x19, 0x5a, 0x0c,	/* h */
+	0x1c, 0x19, 0x17, 0x61, 0xff, 0x02,	/* i */
+	0x19, 0x12, 0x16, 0x12, 0x26, 0x71, 0xff, 0x01,	/* j */
+	0x8a, 0x16, 0x18, 0x11, 0x16, 0x13, 0x1a, 0x0c,	/* k */
+	0x1a, 0x19, 0x89, 0xff, 0x02,	/* l */
+	0x6c, 0x14, 0x69, 0x14, 0x5a, 0x0c,	/* m */
+	0x6c, 0x15, 0x18, 0x19, 0x5a, 0x0c,	/* n */
+	0x4d, 0x15, 0x14, 0x14, 0x14, 0x14, 0x14, 0x45, 0x0d,	/* o */
+	0x8c, 0x13, 0x12, 0x15, 0x14, 0x14, 0x14, 0x45, 0x0d,	/* p */
+	0x4d, 0x15, 0x14, 0x14, 0x14, 0x15, 0x12, 0x85, 0x0a,	/* q */
+	0x6c, 0x15, 0x18, 0x19, 0x1a, 0x1f,	/* r */
+	0x1d, 0x12, 0x15, 0x11, 0x12, 0x14, 0x11, 0x12, 0x14, 0x12, 0x11, 0x15,	/* s */
+	0x12, 0x0d,
+	0x1c, 0x77, 0x15, 0x14, 0x14, 0x14, 0x7f,	/* t */
+	0x5c, 0x1a, 0x19, 0x18, 0x65, 0x0c,	/* u */
+	0x2c, 0x3a, 0x1a, 0x36, 0x25, 0x1f,	/* v */
+	0x4c, 0x39, 0x34, 0x3a, 0x44, 0x0e,	/* w */
+	0x1c, 0x14, 0x15, 0x12, 0x27, 0x17, 0x12, 0x15, 0x14, 0x0c,	/* x */
+	0x2c, 0x15, 0x24, 0x13, 0x36, 0x25, 0x26, 0x1f,	/* y */
+	0x1c, 0x23, 0x14, 0x12, 0x11, 0x14, 0x11, 0x12, 0x24, 0x13, 0x14, 0x14,	/* z */
+	0x0c,
+	0x9f, 0x42, 0x24, 0x85, 0xf1, 0x05,	/* { */
+	0xff, 0xa0, 0xff, 0x00,	/* | */
+	0x5f, 0x81, 0x25, 0x44, 0xf2, 0x09,	/* } */
+	0x2d, 0x18, 0x19, 0x1a, 0x28, 0x0f,	/* ~ */
+};
+
+static const uint16_t font_7x10_offsets[] = {
+	0, 3, 8, 12, 23, 35, 47, 59, 63, 70,
+	77, 84, 90, 94, 99, 103, 108, 118, 123, 136,
+	149, 157, 171, 184, 193, 207, 220, 225, 230, 240,
+	251, 261, 270, 282, 289, 302, 312, 321, 335, 344,
+	356, 362, 369, 375, 384, 390, 396, 402, 411, 420,
+	430, 440, 454, 460, 466, 472, 478, 488, 494, 508,
+	512, 517, 521, 527, 534, 538, 551, 560, 570, 579,
+	592, 600, 613, 619, 625, 633, 641, 646, 652, 658,
+	667, 676, 685, 691, 705, 712, 718, 724, 730, 740,
+	748, 761, 767, 771, 777,
+};
+
+font_def_t font_7x10 = {
+	.font_width = 7,
+	.font_height = 10,
+	.packed = font_7x10_glyphs,
+	.offsets = font_7x10_offsets,
+	.flags = FONT_RLE,
+};
+
+/*  -0123456789:CO: 423 bytes of glyphs (RLE), unpacked 780 */
+static const uint8_t font_16x26_glyphs[] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	/* sp */
+	0xff, 0xbf,
+	0xff, 0xff, 0x23, 0x9f, 0xf2, 0x29, 0x9f, 0xf2, 0x29, 0x9f, 0xf2, 0x29,	/* - */
+	0x9f, 0xf2, 0x29, 0x9f, 0xf2, 0x29, 0x9f, 0xf2, 0x29, 0xff, 0x09,
+	0xff, 0xb1, 0xfd, 0xa0, 0x2f, 0xf8, 0x64, 0x77, 0x57, 0xd4, 0x54, 0xf3,	/* 0 */
+	0x30, 0x25, 0x2f, 0x52, 0xf3, 0x30, 0x45, 0x4d, 0x75, 0x77, 0xf6, 0x84,
+	0x2f, 0xfa, 0xd0, 0xab,
+	0xff, 0x9f, 0xf2, 0x20, 0x27, 0x0f, 0x72, 0xf2, 0x20, 0x36, 0x0f, 0x62,	/* 1 */
+	0xf3, 0x20, 0xf6, 0x55, 0x6f, 0xf5, 0x56, 0x6f, 0xf5, 0xf6, 0x29, 0x9f,
+	0xf2, 0x29, 0x9f, 0x52,
+	0xff, 0x8f, 0xe2, 0x64, 0xd2, 0x55, 0xc3, 0x56, 0xa3, 0x58, 0xa2, 0x16,	/* 2 */
+	0x52, 0x92, 0x35, 0x52, 0x82, 0x45, 0x52, 0x63, 0x55, 0x52, 0x6d, 0x62,
+	0x7b, 0x62, 0x8a, 0x72, 0x98, 0x92, 0xc3, 0xf2, 0x1f,
+	0xff, 0xff, 0x4f, 0xf2, 0x30, 0x35, 0x26, 0x37, 0x35, 0x26, 0x37, 0x25,	/* 3 */
+	0x27, 0x28, 0x25, 0x27, 0x28, 0x25, 0x36, 0x28, 0x35, 0x45, 0x36, 0xd5,
+	0x44, 0xf5, 0x75, 0x18, 0x8a, 0x36, 0xa8, 0x63, 0xf6, 0x4f,
+	0x2d, 0x7f, 0xf4, 0x56, 0x4f, 0xf7, 0x83, 0x1f, 0x26, 0xf2, 0x60, 0x23,	/* 4 */
+	0x5e, 0x25, 0x6c, 0x26, 0xfb, 0x56, 0x6f, 0xf5, 0x56, 0x6f, 0x3f, 0xf2,
+	0x29, 0x9f, 0xb2,
+	0xff, 0xff, 0x3f, 0x8a, 0x53, 0x8a, 0x53, 0x8a, 0x53, 0x9a, 0x52, 0x53,	/* 5 */
+	0x92, 0x52, 0x53, 0x83, 0x52, 0x53, 0x64, 0x53, 0x53, 0x16, 0x56, 0x63,
+	0x6b, 0x63, 0x6b, 0x73, 0xf9, 0x54, 0xff, 0x05,
+	0xff, 0x26, 0x4f, 0xcc, 0x1f, 0xf9, 0x73, 0x4f, 0x57, 0x33, 0x54, 0x45,	/* 6 */
+	0x34, 0x37, 0x35, 0x25, 0x29, 0x25, 0x26, 0x29, 0x25, 0x36, 0x37, 0x25,
+	0x46, 0x45, 0x35, 0xc5, 0x36, 0xb6, 0x27, 0x97, 0x3f, 0x87,
+	0xff, 0x7f, 0xf3, 0x38, 0x1f, 0x52, 0xd3, 0x55, 0xc3, 0x56, 0xa3, 0x58,	/* 7 */
+	0x83, 0x5a, 0x63, 0x89, 0x53, 0xb7, 0x33, 0xd7, 0x13, 0xf7, 0x90, 0x2f,
+	0xf7, 0x64, 0x5f, 0xf4, 0x07,
+	0xff, 0x3a, 0x2d, 0x76, 0x69, 0x93, 0x87, 0xa1, 0xf6, 0x56, 0x5d, 0x53,	/* 8 */
+	0x43, 0x74, 0x53, 0x62, 0x74, 0x52, 0x62, 0x74, 0x52, 0x43, 0x56, 0x53,
+	0x0f, 0x42, 0x95, 0xa1, 0x77, 0x93, 0x58, 0x75, 0x5f, 0x85,
+	0xff, 0x41, 0x5f, 0x78, 0x82, 0x6a, 0x63, 0x6b, 0x53, 0x6d, 0x52, 0x73,	/* 9 */
+	0x63, 0x52, 0x92, 0x62, 0x52, 0x92, 0x52, 0x53, 0x83, 0x52, 0x53, 0x64,
+	0x33, 0x55, 0x1c, 0x77, 0x3f, 0xf9, 0xb1, 0xee, 0xc9,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x47, 0x4b, 0x47, 0x4b, 0x47, 0x4b,	/* : */
+	0x47, 0x4b, 0x47, 0xff, 0xff, 0xff, 0xff, 0x0f,
+	0xff, 0x84, 0x1f, 0xdc, 0xce, 0xbe, 0x55, 0xa6, 0x93, 0x94, 0xb3, 0x84,	/* C */
+	0xc3, 0x83, 0xe2, 0x82, 0xe2, 0x82, 0xe2, 0x82, 0xe2, 0x82, 0xd3, 0x82,
+	0xc3, 0x83, 0xc3, 0x53,
+	0x69, 0x2f, 0xdc, 0xbe, 0x1f, 0xfa, 0x91, 0xa4, 0x84, 0xc3, 0x83, 0xe2,	/* O */
+	0x82, 0xe2, 0x82, 0xe2, 0x82, 0xc3, 0x83, 0xa4, 0x94, 0x1f, 0xfa, 0xb1,
+	0xde, 0x8c,
+};
+
+static const uint16_t font_16x26_offsets[] = {
+	0, 14, 37, 65, 93, 126, 160, 187, 219, 253,
+	282, 316, 349, 369, 397,
+};
+
+font_def_t font_16x26 = {
+	.font_width = 16,
+	.font_height = 26,
+	.packed = font_16x26_glyphs,
+	.offsets = font_16x26_offsets,
+	.chars = " -0123456789:CO",
+	.flags = FONT_RLE,
+};
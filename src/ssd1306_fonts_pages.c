@@ -0,0 +1,1357 @@
+/* Generated by tools/font_pages.py from ssd1306_fonts.c, do not edit */
+
+#include "../inc/ssd1306_fonts.h"
+
+#ifdef SSD1306_INCLUDE_FONT_7x10
+/* 2 pages x 7 columns per glyph */
+const uint8_t font7x10_pages[] = {
+	/* sp */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ! */
+	0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* " */
+	0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* # */
+	0x00, 0xf4, 0x2f, 0x24, 0xf4, 0x2f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* $ */
+	0x00, 0x66, 0x89, 0xff, 0x89, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	/* % */
+	0x00, 0x26, 0x19, 0x6e, 0x94, 0x62, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* & */
+	0x00, 0x60, 0x96, 0x99, 0x66, 0x90, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ' */
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ( */
+	0x00, 0x00, 0xfc, 0x02, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	/* ) */
+	0x00, 0x00, 0x01, 0x02, 0xfc, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,
+	/* * */
+	0x00, 0x00, 0x0a, 0x07, 0x0a, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* + */
+	0x00, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* , */
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	/* - */
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* . */
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* / */
+	0x00, 0x00, 0xc0, 0x3c, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0 */
+	0x00, 0x7e, 0x81, 0x89, 0x81, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 1 */
+	0x00, 0x04, 0x02, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 2 */
+	0x00, 0x86, 0xc1, 0xa1, 0x91, 0x8e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 3 */
+	0x00, 0x42, 0x81, 0x89, 0x89, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 4 */
+	0x00, 0x30, 0x2c, 0x22, 0xff, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 5 */
+	0x00, 0x4f, 0x89, 0x89, 0x89, 0x71, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 6 */
+	0x00, 0x7e, 0x89, 0x89, 0x89, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 7 */
+	0x00, 0x01, 0xe1, 0x19, 0x05, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 8 */
+	0x00, 0x76, 0x89, 0x89, 0x89, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 9 */
+	0x00, 0x4e, 0x91, 0x91, 0x91, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* : */
+	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ; */
+	0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	/* < */
+	0x00, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* = */
+	0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* > */
+	0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ? */
+	0x00, 0x02, 0x01, 0xb1, 0x09, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* @ */
+	0x00, 0x7e, 0x81, 0x99, 0x95, 0x1e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* A */
+	0x00, 0xe0, 0x3e, 0x21, 0x3e, 0xe0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* B */
+	0x00, 0xff, 0x89, 0x89, 0x89, 0x76, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* C */
+	0x00, 0x7e, 0x81, 0x81, 0x81, 0x42, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* D */
+	0x00, 0xff, 0x81, 0x81, 0x42, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* E */
+	0x00, 0xff, 0x89, 0x89, 0x89, 0x89, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* F */
+	0x00, 0xff, 0x09, 0x09, 0x09, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* G */
+	0x00, 0x7e, 0x81, 0x91, 0x91, 0x72, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* H */
+	0x00, 0xff, 0x08, 0x08, 0x08, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* I */
+	0x00, 0x00, 0x81, 0xff, 0x81, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* J */
+	0x00, 0x40, 0x80, 0x80, 0x80, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* K */
+	0x00, 0xff, 0x08, 0x14, 0x62, 0x81, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* L */
+	0x00, 0xff, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* M */
+	0x00, 0xff, 0x06, 0x08, 0x06, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* N */
+	0x00, 0xff, 0x06, 0x18, 0x60, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* O */
+	0x00, 0x7e, 0x81, 0x81, 0x81, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* P */
+	0x00, 0xff, 0x11, 0x11, 0x11, 0x0e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Q */
+	0x00, 0x7e, 0x81, 0xc1, 0x81, 0x7e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	/* R */
+	0x00, 0xff, 0x11, 0x11, 0x71, 0x8e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* S */
+	0x00, 0x46, 0x89, 0x89, 0x91, 0x62, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* T */
+	0x00, 0x01, 0x01, 0xff, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* U */
+	0x00, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* V */
+	0x00, 0x07, 0x38, 0xc0, 0x38, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* W */
+	0x00, 0x3f, 0xe0, 0x1c, 0xe0, 0x3f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* X */
+	0x00, 0x81, 0x66, 0x18, 0x66, 0x81, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Y */
+	0x00, 0x03, 0x0c, 0xf0, 0x0c, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Z */
+	0x00, 0xc1, 0xa1, 0x99, 0x85, 0x83, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* [ */
+	0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,
+	/* \ */
+	0x00, 0x00, 0x03, 0x3c, 0xc0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ] */
+	0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+	/* ^ */
+	0x00, 0x08, 0x06, 0x01, 0x06, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* _ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	/* ` */
+	0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* a */
+	0x00, 0x68, 0x94, 0x94, 0x54, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* b */
+	0x00, 0xff, 0x48, 0x84, 0x84, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* c */
+	0x00, 0x78, 0x84, 0x84, 0x84, 0x48, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* d */
+	0x00, 0x78, 0x84, 0x84, 0x48, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* e */
+	0x00, 0x78, 0x94, 0x94, 0x94, 0x58, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* f */
+	0x00, 0x04, 0x04, 0xfe, 0x05, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* g */
+	0x00, 0x78, 0x84, 0x84, 0x48, 0xfc, 0x00,
+	0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,
+	/* h */
+	0x00, 0xff, 0x08, 0x04, 0x04, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* i */
+	0x00, 0x04, 0x04, 0xfd, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* j */
+	0x00, 0x04, 0x04, 0xfd, 0x00, 0x00, 0x00,
+	0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,
+	/* k */
+	0x00, 0xff, 0x10, 0x28, 0x44, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* l */
+	0x00, 0x01, 0x01, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* m */
+	0x00, 0xfc, 0x04, 0xfc, 0x04, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* n */
+	0x00, 0xfc, 0x08, 0x04, 0x04, 0xf8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* o */
+	0x00, 0x78, 0x84, 0x84, 0x84, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* p */
+	0x00, 0xfc, 0x48, 0x84, 0x84, 0x78, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* q */
+	0x00, 0x78, 0x84, 0x84, 0x48, 0xfc, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	/* r */
+	0x00, 0xfc, 0x08, 0x04, 0x04, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* s */
+	0x00, 0x48, 0x94, 0x94, 0xa4, 0x48, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* t */
+	0x00, 0x04, 0x7f, 0x84, 0x84, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* u */
+	0x00, 0x7c, 0x80, 0x80, 0x40, 0xfc, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* v */
+	0x00, 0x0c, 0x70, 0x80, 0x70, 0x0c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* w */
+	0x00, 0x3c, 0xe0, 0x1c, 0xe0, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* x */
+	0x00, 0x84, 0x48, 0x30, 0x48, 0x84, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* y */
+	0x00, 0x0c, 0x30, 0xc0, 0x30, 0x0c, 0x00,
+	0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,
+	/* z */
+	0x00, 0xc4, 0xa4, 0x94, 0x8c, 0x84, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* { */
+	0x00, 0x00, 0x30, 0xcf, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,
+	/* | */
+	0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	/* } */
+	0x00, 0x00, 0x01, 0xcf, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+	/* ~ */
+	0x00, 0x18, 0x08, 0x08, 0x10, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_11x18
+/* 3 pages x 11 columns per glyph */
+const uint8_t font11x18_pages[] = {
+	/* sp */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ! */
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* " */
+	0x00, 0x00, 0x00, 0x3e, 0x3e, 0x00, 0x3e, 0x3e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* # */
+	0x00, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x00,
+	0x00, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* $ */
+	0x00, 0x38, 0x7c, 0xee, 0xc6, 0xfe, 0x86, 0x1c, 0x18, 0x00, 0x00,
+	0x00, 0x1c, 0x3c, 0x70, 0x60, 0xff, 0x61, 0x3f, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* % */
+	0x3c, 0x7e, 0x42, 0x7e, 0x3c, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x00,
+	0x00, 0x18, 0x0c, 0x06, 0x03, 0x3d, 0x7e, 0x42, 0x7e, 0x3c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* & */
+	0x00, 0x00, 0x3c, 0x7e, 0xc6, 0xc6, 0x7e, 0x3c, 0x00, 0x00, 0x00,
+	0x00, 0x1e, 0x3f, 0x61, 0x61, 0x63, 0x36, 0x1c, 0x7f, 0x23, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ' */
+	0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ( */
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0x1c, 0x06, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x7f, 0xe0, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	/* ) */
+	0x00, 0x00, 0x01, 0x06, 0x1c, 0xf8, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xe0, 0x7f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* * */
+	0x00, 0x00, 0x2c, 0x38, 0x1e, 0x1e, 0x38, 0x2c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* + */
+	0x80, 0x80, 0x80, 0x80, 0xf8, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x1f, 0x1f, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* , */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* - */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* . */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* / */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xfe, 0x0e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x7f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0 */
+	0x00, 0xf0, 0xfc, 0x0e, 0x86, 0x86, 0x0e, 0xfc, 0xf0, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x61, 0x61, 0x70, 0x3f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 1 */
+	0x00, 0x00, 0x30, 0x18, 0x0c, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 2 */
+	0x00, 0x38, 0x3c, 0x0e, 0x06, 0x06, 0x8e, 0xfc, 0x78, 0x00, 0x00,
+	0x00, 0x70, 0x78, 0x6c, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 3 */
+	0x00, 0x18, 0x1c, 0x06, 0xc6, 0xc6, 0xfc, 0x38, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x38, 0x70, 0x60, 0x60, 0x71, 0x3f, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 4 */
+	0x00, 0x00, 0x80, 0xf0, 0x3c, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0e, 0x0f, 0x0d, 0x0c, 0x7f, 0x7f, 0x0c, 0x0c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 5 */
+	0x00, 0xfe, 0xfe, 0x86, 0xc6, 0xc6, 0xc6, 0x86, 0x00, 0x00, 0x00,
+	0x00, 0x19, 0x39, 0x70, 0x60, 0x60, 0x71, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 6 */
+	0x00, 0xf0, 0xfc, 0x8e, 0xc6, 0xc6, 0xce, 0x9c, 0x18, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x71, 0x60, 0x60, 0x71, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 7 */
+	0x00, 0x06, 0x06, 0x06, 0x06, 0xc6, 0xf6, 0x3e, 0x0e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x70, 0x7f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 8 */
+	0x00, 0x38, 0x7c, 0x86, 0x86, 0x86, 0x8e, 0x7c, 0x38, 0x00, 0x00,
+	0x00, 0x1e, 0x3f, 0x61, 0x61, 0x61, 0x61, 0x3f, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 9 */
+	0x00, 0xf8, 0xfc, 0x8e, 0x06, 0x06, 0x8e, 0xfc, 0xf0, 0x00, 0x00,
+	0x00, 0x18, 0x39, 0x73, 0x63, 0x63, 0x71, 0x3f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* : */
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ; */
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* < */
+	0x00, 0x00, 0x80, 0x80, 0xc0, 0x40, 0x60, 0x20, 0x30, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0c, 0x08, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* = */
+	0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+	0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* > */
+	0x00, 0x30, 0x20, 0x60, 0x40, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x18, 0x08, 0x0c, 0x04, 0x06, 0x02, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ? */
+	0x00, 0x18, 0x1c, 0x0e, 0x06, 0x06, 0x86, 0xce, 0xfc, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x03, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* @ */
+	0x00, 0xf0, 0xfc, 0x1e, 0xc6, 0xc6, 0x66, 0xfc, 0xf8, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x63, 0x67, 0x36, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* A */
+	0x00, 0x00, 0x80, 0xf8, 0x7e, 0x06, 0x7e, 0xf8, 0x80, 0x00, 0x00,
+	0x00, 0x70, 0x7f, 0x0f, 0x06, 0x06, 0x06, 0x0f, 0x7f, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* B */
+	0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0xfc, 0x78, 0x00, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x61, 0x61, 0x61, 0x73, 0x3e, 0x1c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* C */
+	0x00, 0xf0, 0xfc, 0x0e, 0x06, 0x06, 0x06, 0x1c, 0x18, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x60, 0x60, 0x60, 0x38, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* D */
+	0x00, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x1c, 0xfc, 0xf0, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x38, 0x1f, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* E */
+	0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* F */
+	0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* G */
+	0x00, 0xf0, 0xfc, 0x0e, 0x06, 0x06, 0x06, 0x1c, 0x18, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x60, 0x60, 0x63, 0x3f, 0x3f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* H */
+	0x00, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* I */
+	0x00, 0x00, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* J */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x1c, 0x3c, 0x70, 0x60, 0x60, 0x70, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* K */
+	0x00, 0xfe, 0xfe, 0x80, 0xc0, 0x70, 0x38, 0x0c, 0x06, 0x02, 0x00,
+	0x00, 0x7f, 0x7f, 0x01, 0x01, 0x07, 0x0e, 0x38, 0x70, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* L */
+	0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* M */
+	0x00, 0xfe, 0xfe, 0x1e, 0xf8, 0x80, 0xf8, 0x0e, 0xfe, 0xfe, 0x00,
+	0x00, 0x7f, 0x7f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7f, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* N */
+	0x00, 0xfe, 0xfe, 0x3e, 0xf8, 0xc0, 0x00, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x00, 0x01, 0x1f, 0x7c, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* O */
+	0x00, 0xf0, 0xfc, 0x0e, 0x06, 0x06, 0x0e, 0xfc, 0xf0, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x60, 0x60, 0x70, 0x3f, 0x0f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* P */
+	0x00, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x8e, 0xfc, 0xf8, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Q */
+	0x00, 0xf0, 0xfc, 0x0e, 0x06, 0x06, 0x0e, 0xfc, 0xf0, 0x00, 0x00,
+	0x00, 0x0f, 0x3f, 0x70, 0x60, 0x6c, 0x78, 0x3f, 0x2f, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* R */
+	0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0xce, 0xfc, 0x78, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x01, 0x01, 0x03, 0x0f, 0x3c, 0x70, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* S */
+	0x00, 0x00, 0x78, 0xfc, 0xc6, 0x86, 0x86, 0x1c, 0x18, 0x00, 0x00,
+	0x00, 0x0c, 0x3c, 0x70, 0x60, 0x61, 0x63, 0x3f, 0x1e, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* T */
+	0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* U */
+	0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x1f, 0x3f, 0x70, 0x60, 0x60, 0x70, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* V */
+	0x00, 0x0e, 0x7e, 0xf0, 0x80, 0x00, 0x80, 0xf0, 0x7e, 0x0e, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x3f, 0x78, 0x3f, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* W */
+	0x7e, 0xfe, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xfe, 0x7e, 0x00,
+	0x00, 0x7f, 0x70, 0x1e, 0x03, 0x03, 0x1e, 0x70, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* X */
+	0x02, 0x0e, 0x3c, 0x70, 0xe0, 0xc0, 0x70, 0x38, 0x0e, 0x02, 0x00,
+	0x40, 0x70, 0x38, 0x1e, 0x0f, 0x07, 0x0e, 0x3c, 0x70, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Y */
+	0x02, 0x0e, 0x3c, 0xf0, 0xc0, 0xc0, 0xf0, 0x3c, 0x0e, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Z */
+	0x00, 0x00, 0x06, 0x06, 0x86, 0xc6, 0x76, 0x3e, 0x0e, 0x00, 0x00,
+	0x00, 0x70, 0x78, 0x6e, 0x67, 0x61, 0x60, 0x60, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* [ */
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+	/* \ */
+	0x00, 0x00, 0x00, 0x0e, 0xfe, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x7f, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ] */
+	0x00, 0x00, 0x00, 0x03, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	/* ^ */
+	0x00, 0x80, 0xe0, 0x78, 0x0e, 0x0e, 0x78, 0xe0, 0x80, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* _ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	/* ` */
+	0x00, 0x00, 0x02, 0x06, 0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* a */
+	0x00, 0x80, 0xc0, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x00, 0x00,
+	0x00, 0x38, 0x7c, 0x66, 0x66, 0x26, 0x36, 0x3f, 0x7f, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* b */
+	0x00, 0xfe, 0xfe, 0xc0, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x30, 0x60, 0x60, 0x70, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* c */
+	0x00, 0x80, 0xc0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0x00, 0x00,
+	0x00, 0x1f, 0x3f, 0x70, 0x60, 0x60, 0x70, 0x39, 0x19, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* d */
+	0x00, 0x80, 0xc0, 0xe0, 0x60, 0x60, 0xc0, 0xfe, 0xfe, 0x00, 0x00,
+	0x00, 0x1f, 0x3f, 0x70, 0x60, 0x60, 0x30, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* e */
+	0x00, 0x80, 0xc0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0x1f, 0x3f, 0x76, 0x66, 0x66, 0x66, 0x37, 0x17, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* f */
+	0x00, 0x60, 0x60, 0x60, 0xfc, 0xfe, 0x66, 0x66, 0x66, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* g */
+	0x00, 0xc0, 0xe0, 0x70, 0x30, 0x30, 0x60, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x8f, 0x9f, 0x38, 0x30, 0x30, 0x98, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,
+	/* h */
+	0x00, 0xfe, 0xfe, 0xc0, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* i */
+	0x00, 0x00, 0x60, 0x60, 0x60, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* j */
+	0x00, 0x00, 0x30, 0x30, 0x30, 0xf3, 0xf3, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+	/* k */
+	0x00, 0xfe, 0xfe, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x20, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x06, 0x03, 0x07, 0x1c, 0x38, 0x60, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* l */
+	0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* m */
+	0xe0, 0xe0, 0x40, 0x60, 0xe0, 0xe0, 0xc0, 0x60, 0xe0, 0xc0, 0x00,
+	0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x7f, 0x7f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* n */
+	0x00, 0xe0, 0xe0, 0xc0, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x00, 0x00,
+	0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* o */
+	0x00, 0x80, 0xc0, 0xe0, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0x00, 0x00,
+	0x00, 0x1f, 0x3f, 0x70, 0x60, 0x60, 0x70, 0x3f, 0x1f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* p */
+	0x00, 0xf0, 0xf0, 0x60, 0x30, 0x30, 0x70, 0xe0, 0xc0, 0x00, 0x00,
+	0x00, 0xff, 0xff, 0x18, 0x30, 0x30, 0x38, 0x1f, 0x0f, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* q */
+	0x00, 0xc0, 0xe0, 0x70, 0x30, 0x30, 0x60, 0xf0, 0xf0, 0x00, 0x00,
+	0x00, 0x0f, 0x1f, 0x38, 0x30, 0x30, 0x18, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+	/* r */
+	0x00, 0x20, 0xe0, 0xc0, 0xc0, 0x60, 0x60, 0xe0, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* s */
+	0x00, 0x80, 0xc0, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x00, 0x00,
+	0x00, 0x33, 0x37, 0x66, 0x66, 0x66, 0x66, 0x3e, 0x1c, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* t */
+	0x00, 0x60, 0x60, 0xf8, 0xfc, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x3f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* u */
+	0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00,
+	0x00, 0x3f, 0x7f, 0x60, 0x60, 0x60, 0x30, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* v */
+	0x00, 0x20, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x00,
+	0x00, 0x00, 0x01, 0x0f, 0x3e, 0x70, 0x7e, 0x0f, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* w */
+	0xe0, 0xe0, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0xe0, 0xe0, 0x00, 0x00,
+	0x00, 0x1f, 0x78, 0x1f, 0x00, 0x1f, 0x78, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* x */
+	0x00, 0x20, 0xe0, 0xc0, 0x00, 0x00, 0xc0, 0xe0, 0x20, 0x00, 0x00,
+	0x00, 0x40, 0x70, 0x39, 0x0f, 0x0f, 0x39, 0x70, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* y */
+	0x00, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x80, 0xf0, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x8f, 0xfe, 0xf0, 0x7f, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* z */
+	0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0x60, 0x00,
+	0x00, 0x60, 0x70, 0x78, 0x6c, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* { */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xfe, 0xff, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00,
+	/* | */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+	/* } */
+	0x00, 0x00, 0x03, 0x03, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x07, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ~ */
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_16x26
+/* 4 pages x 16 columns per glyph */
+const uint8_t font16x26_pages[] = {
+	/* sp */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ! */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* " */
+	0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* # */
+	0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xe0, 0xfe, 0xff, 0xff, 0xc7, 0xc0, 0xfc, 0xff, 0xff, 0xcf, 0xc0,
+	0x60, 0x60, 0x60, 0xe0, 0xfe, 0xff, 0xff, 0x6f, 0xe0, 0xfc, 0xff, 0xff, 0x7f, 0x60, 0x60, 0x60,
+	0x00, 0x00, 0x1c, 0x1f, 0x1f, 0x0f, 0x00, 0x18, 0x1f, 0x1f, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* $ */
+	0x00, 0x00, 0x00, 0xfc, 0xfe, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x03, 0x07, 0x07, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf8, 0xf0, 0x00,
+	0x00, 0x00, 0x0c, 0x0c, 0x1c, 0x1c, 0x18, 0x7f, 0x7f, 0x7f, 0x7f, 0x1f, 0x0f, 0x0f, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* % */
+	0xfe, 0xfe, 0xff, 0x03, 0x01, 0xcf, 0xff, 0xfe, 0xfc, 0x80, 0xe0, 0xf0, 0xfc, 0x3e, 0x1f, 0x07,
+	0x01, 0x01, 0x03, 0x83, 0xc2, 0xf3, 0xfb, 0x7f, 0xff, 0xff, 0xfb, 0xf9, 0x18, 0x18, 0xf8, 0xf8,
+	0x18, 0x1c, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x18, 0x18, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* & */
+	0x00, 0x00, 0x00, 0x38, 0xfe, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xfe, 0x7e, 0x00, 0x00, 0x00,
+	0xf8, 0xfc, 0xfc, 0xfe, 0x0f, 0x07, 0x1f, 0x3f, 0xff, 0xfd, 0xf1, 0xe0, 0x80, 0xf0, 0xfc, 0xfc,
+	0x03, 0x07, 0x0f, 0x1f, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x1d, 0x1f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1d,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ( */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xfc, 0xfc, 0x3e, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x3f, 0x3f, 0x7c, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+	/* ) */
+	0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x3e, 0xfc, 0xfc, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0xf0, 0x7c, 0x3f, 0x3f, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* * */
+	0x00, 0x00, 0x38, 0x38, 0x38, 0x30, 0xf3, 0xff, 0x1f, 0xbf, 0xf1, 0xb0, 0x38, 0x38, 0x38, 0x30,
+	0x00, 0x00, 0x00, 0x04, 0x06, 0x0f, 0x0f, 0x07, 0x01, 0x03, 0x0f, 0x0f, 0x0f, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* + */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xff, 0xff, 0xff, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* , */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* - */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* . */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* / */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 0 */
+	0x00, 0xe0, 0xf8, 0xfc, 0xfe, 0x7f, 0x0f, 0x07, 0x03, 0x07, 0x0f, 0x7f, 0xfe, 0xfc, 0xf8, 0xe0,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0x1e, 0x1c, 0x18, 0x1c, 0x1e, 0x1f, 0x0f, 0x07, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 1 */
+	0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0e, 0x0e, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 2 */
+	0x00, 0x00, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xff, 0xfe, 0xfe, 0xfc, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x1e, 0x1f, 0x1f, 0x1f, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 3 */
+	0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xff, 0xff, 0xfe, 0xfc, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x07, 0x0f, 0x1f, 0xff, 0xfd, 0xf8, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x07, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 4 */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x60, 0x78, 0x7c, 0x7f, 0x7f, 0x67, 0x63, 0x60, 0x60, 0xff, 0xff, 0xff, 0xff, 0x60, 0x60, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 5 */
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0f, 0xbf, 0xfe, 0xfe, 0xfc, 0xf0, 0x00,
+	0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 6 */
+	0x00, 0x00, 0xe0, 0xf8, 0xfc, 0xfe, 0x3e, 0x0f, 0x07, 0x03, 0x03, 0x03, 0x07, 0x07, 0x06, 0x00,
+	0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x07, 0x03, 0x03, 0x07, 0x0f, 0xff, 0xfe, 0xfc, 0xf8,
+	0x00, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x18, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 7 */
+	0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xc7, 0xf7, 0xff, 0x7f, 0x3f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0x7f, 0x1f, 0x07, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 8 */
+	0x00, 0x00, 0x30, 0xfc, 0xfe, 0xff, 0xff, 0x87, 0x03, 0x03, 0x87, 0xff, 0xff, 0xfe, 0x7c, 0x00,
+	0x00, 0xc0, 0xf0, 0xf8, 0xfd, 0xff, 0x1f, 0x07, 0x0f, 0x0f, 0x1f, 0x7f, 0xfd, 0xf8, 0xf0, 0xe0,
+	0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x1c, 0x18, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 9 */
+	0x00, 0xe0, 0xf8, 0xfc, 0xfe, 0xff, 0x07, 0x03, 0x03, 0x07, 0x0f, 0xff, 0xfe, 0xfc, 0xf8, 0xe0,
+	0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0xef, 0xff, 0xff, 0xff, 0x3f,
+	0x00, 0x00, 0x0c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* : */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ; */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* < */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0,
+	0x20, 0x20, 0x70, 0x70, 0xf8, 0xf8, 0xfc, 0xdc, 0x8e, 0x8e, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0e, 0x0e, 0x1c, 0x1c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* = */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* > */
+	0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x8e, 0x8e, 0xdc, 0xdc, 0xf8, 0xf8, 0x70, 0x70, 0x20,
+	0x18, 0x1c, 0x1c, 0x0e, 0x0e, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ? */
+	0x00, 0x00, 0x1e, 0x1f, 0x1f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0xff, 0xfe, 0xfe, 0x7c, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x78, 0x7c, 0x7e, 0x7f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* @ */
+	0x00, 0xe0, 0xf8, 0xfc, 0x7e, 0x1e, 0x8f, 0xc7, 0xe3, 0xf3, 0x73, 0x37, 0x7f, 0xfe, 0xfe, 0xf8,
+	0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xc1, 0xc0, 0xf0, 0xfe, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1c, 0x1d, 0x19, 0x19, 0x19, 0x1d, 0x1c, 0x0d, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* A */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xe0, 0xf8, 0xff, 0xff, 0xdf, 0xc3, 0xc0, 0xc7, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x80,
+	0x1c, 0x1f, 0x1f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* B */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xf8, 0xf8, 0xf0, 0xe0, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18, 0x18, 0x3c, 0x3e, 0xff, 0xf7, 0xe7, 0xe3, 0xc0,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* C */
+	0x00, 0x00, 0xc0, 0xe0, 0xe0, 0xf0, 0x70, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x38,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* D */
+	0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x0f, 0x0f, 0x07, 0x07, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* E */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* F */
+	0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* G */
+	0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x78, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30,
+	0x3c, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0xf0,
+	0x00, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x1f, 0x0f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* H */
+	0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* I */
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* J */
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+	0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* K */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf8, 0x78, 0x38, 0x18, 0x08,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x7f, 0xff, 0xf7, 0xe3, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0x1e, 0x1c, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* L */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* M */
+	0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x3f, 0xff, 0xfe, 0xf0, 0xfe, 0xff, 0x1f, 0x03, 0xff, 0xff, 0xff,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* N */
+	0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x0f, 0x3f, 0xff, 0xfc, 0xf8, 0xe0, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* O */
+	0x00, 0xc0, 0xe0, 0xf0, 0xf0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xf0, 0xf0, 0xe0, 0xc0,
+	0x7e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* P */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xf8, 0xf8, 0xf0, 0xf0,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x30, 0x30, 0x38, 0x3c, 0x1f, 0x1f, 0x0f, 0x0f,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Q */
+	0x00, 0xc0, 0xe0, 0xf0, 0xf0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xf0, 0xf0, 0xe0, 0xc0,
+	0x7e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x18, 0x18, 0x38, 0x7c, 0x7e, 0xff, 0xef, 0xc7, 0xc3,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+	/* R */
+	0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x38, 0x78, 0xf8, 0xf0, 0xf0, 0xe0, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x30, 0x70, 0xf8, 0xf8, 0xfe, 0xdf, 0x8f, 0x0f, 0x03, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x1f, 0x1e, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* S */
+	0x00, 0x00, 0xe0, 0xf0, 0xf0, 0xf8, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x00,
+	0x00, 0x00, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x1c, 0x3c, 0x38, 0x78, 0xf8, 0xf0, 0xf0, 0xe0,
+	0x00, 0x00, 0x0e, 0x1c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* T */
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* U */
+	0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8,
+	0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x00, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* V */
+	0x38, 0xf8, 0xf8, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xf8, 0xf8,
+	0x00, 0x00, 0x07, 0x3f, 0xff, 0xff, 0xfc, 0xf0, 0x80, 0xe0, 0xf8, 0xff, 0xff, 0x1f, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* W */
+	0xf8, 0xf8, 0xf8, 0xf0, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xc0, 0xf8, 0xf8,
+	0x03, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xf8, 0xe0, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x03, 0x00, 0x03, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* X */
+	0x08, 0x18, 0x78, 0xf8, 0xf8, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0x78, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0xc1, 0xe7, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xe3, 0xc1, 0x80, 0x00, 0x00,
+	0x10, 0x1c, 0x1e, 0x1f, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1f, 0x1f, 0x1e, 0x1c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Y */
+	0x08, 0x38, 0xf8, 0xf8, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf8, 0xf8, 0x38,
+	0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0x0f, 0x07, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* Z */
+	0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0xd8, 0xf8, 0xf8, 0xf8, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0x7e, 0x3f, 0x1f, 0x07, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x1c, 0x1e, 0x1f, 0x1f, 0x1f, 0x1b, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* [ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	/* \ */
+	0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	/* ] */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	/* ^ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfe, 0x7f, 0xff, 0xf8, 0xe0, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0xf0, 0xfc, 0xff, 0x3f, 0x0f, 0x03, 0x00, 0x01, 0x0f, 0x3f, 0xff, 0xfc, 0xf0, 0xc0,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* _ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ` */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* a */
+	0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00,
+	0x00, 0x80, 0xc1, 0xe1, 0xe1, 0xf1, 0x70, 0x30, 0x30, 0x31, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
+	0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x1e, 0x18, 0x18, 0x18, 0x1c, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* b */
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x0f, 0x1c, 0x1c, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* c */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80,
+	0x00, 0x70, 0xfe, 0xff, 0xff, 0xff, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* d */
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0x9f, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x18, 0x1c, 0x0e, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* e */
+	0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00,
+	0x00, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0x33, 0x31, 0x30, 0x30, 0x31, 0x3f, 0x3f, 0x3f, 0x3f, 0x3c,
+	0x00, 0x00, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1c, 0x0c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* f */
+	0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xc3, 0xc1, 0xc1, 0xc1, 0xc1, 0xc3,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* g */
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0x8f, 0x01, 0x00, 0x00, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0x00, 0x01, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x18, 0x1c, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x1f,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
+	/* h */
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* i */
+	0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* j */
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+	/* k */
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x40,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x70, 0xfc, 0xfe, 0xff, 0xcf, 0x87, 0x03, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1f, 0x1f, 0x1e, 0x1c, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* l */
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* m */
+	0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80,
+	0xff, 0xff, 0xff, 0xff, 0x0f, 0x03, 0x07, 0xff, 0xff, 0xff, 0x0f, 0x03, 0x03, 0xff, 0xff, 0xff,
+	0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* n */
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* o */
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00,
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0xff, 0xff, 0xff, 0xfe,
+	0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x1c, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* p */
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xfe,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x1c, 0x18, 0x18, 0x1c, 0x1f, 0x1f, 0x0f, 0x07, 0x01,
+	0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* q */
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0x00,
+	0x00, 0xfc, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x03, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x18, 0x1c, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00,
+	/* r */
+	0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07,
+	0x00, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* s */
+	0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00,
+	0x00, 0x00, 0x0e, 0x1f, 0x1f, 0x3f, 0x3f, 0x38, 0x70, 0x70, 0xf0, 0xe0, 0xe1, 0xe1, 0xc1, 0x00,
+	0x00, 0x00, 0x0c, 0x1c, 0x1c, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x1c, 0x1f, 0x0f, 0x0f, 0x07, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* t */
+	0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xf8, 0xf8, 0xf8, 0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* u */
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x00,
+	0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
+	0x00, 0x00, 0x07, 0x0f, 0x1f, 0x1f, 0x1c, 0x18, 0x1c, 0x1e, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* v */
+	0x40, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0,
+	0x00, 0x01, 0x0f, 0x3f, 0xff, 0xfe, 0xf8, 0xc0, 0x00, 0xc0, 0xf0, 0xfe, 0xff, 0x3f, 0x0f, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* w */
+	0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xc0, 0xc0,
+	0x0f, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0xc0, 0xfe, 0xff, 0xff,
+	0x00, 0x01, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x01, 0x00, 0x01, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* x */
+	0x00, 0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x40,
+	0x00, 0x00, 0x01, 0x03, 0x07, 0xdf, 0xff, 0xfe, 0xfc, 0xfc, 0xff, 0xdf, 0x87, 0x03, 0x00, 0x00,
+	0x00, 0x10, 0x1c, 0x1e, 0x1f, 0x0f, 0x07, 0x01, 0x01, 0x03, 0x07, 0x1f, 0x1f, 0x1e, 0x1c, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* y */
+	0x40, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0,
+	0x00, 0x01, 0x07, 0x3f, 0xff, 0xff, 0xf8, 0xe0, 0x80, 0xc0, 0xf8, 0xfe, 0xff, 0x3f, 0x07, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0x7f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* z */
+	0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+	0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0x7c, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x01,
+	0x00, 0x18, 0x1c, 0x1f, 0x1f, 0x1f, 0x1b, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* { */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xff, 0xc3, 0x01, 0x01, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3c, 0xff, 0xff, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xff, 0xc3, 0x80, 0x80, 0x80, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	/* | */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* } */
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x83, 0xff, 0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xe7, 0xff, 0xff, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x00,
+	0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xc1, 0xff, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ~ */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xc0, 0xf0, 0xf8, 0xf8, 0x18, 0x18, 0x38, 0x78, 0x70, 0xf0, 0xe0, 0xc0, 0xc0, 0xf8, 0xf8, 0x78,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+#ifdef SSD1306_INCLUDE_FONT_6x8
+/* 1 pages x 6 columns per glyph */
+const uint8_t font6x8_pages[] = {
+	/* sp */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* ! */
+	0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	/* " */
+	0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
+	/* # */
+	0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00,
+	/* $ */
+	0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00,
+	/* % */
+	0x23, 0x13, 0x08, 0x64, 0x62, 0x00,
+	/* & */
+	0x36, 0x49, 0x56, 0x20, 0x50, 0x00,
+	/* ' */
+	0x00, 0x08, 0x07, 0x03, 0x00, 0x00,
+	/* ( */
+	0x00, 0x1c, 0x22, 0x41, 0x00, 0x00,
+	/* ) */
+	0x00, 0x41, 0x22, 0x1c, 0x00, 0x00,
+	/* * */
+	0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x00,
+	/* + */
+	0x08, 0x08, 0x3e, 0x08, 0x08, 0x00,
+	/* , */
+	0x00, 0x00, 0x70, 0x30, 0x00, 0x00,
+	/* - */
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+	/* . */
+	0x00, 0x00, 0x60, 0x60, 0x00, 0x00,
+	/* / */
+	0x20, 0x10, 0x08, 0x04, 0x02, 0x00,
+	/* 0 */
+	0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00,
+	/* 1 */
+	0x00, 0x42, 0x7f, 0x40, 0x00, 0x00,
+	/* 2 */
+	0x72, 0x49, 0x49, 0x49, 0x46, 0x00,
+	/* 3 */
+	0x21, 0x41, 0x49, 0x4d, 0x33, 0x00,
+	/* 4 */
+	0x18, 0x14, 0x12, 0x7f, 0x10, 0x00,
+	/* 5 */
+	0x27, 0x45, 0x45, 0x45, 0x39, 0x00,
+	/* 6 */
+	0x3c, 0x4a, 0x49, 0x49, 0x31, 0x00,
+	/* 7 */
+	0x41, 0x21, 0x11, 0x09, 0x07, 0x00,
+	/* 8 */
+	0x36, 0x49, 0x49, 0x49, 0x36, 0x00,
+	/* 9 */
+	0x46, 0x49, 0x49, 0x29, 0x1e, 0x00,
+	/* : */
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	/* ; */
+	0x00, 0x40, 0x34, 0x00, 0x00, 0x00,
+	/* < */
+	0x00, 0x08, 0x14, 0x22, 0x41, 0x00,
+	/* = */
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x00,
+	/* > */
+	0x00, 0x41, 0x22, 0x14, 0x08, 0x00,
+	/* ? */
+	0x02, 0x01, 0x59, 0x09, 0x06, 0x00,
+	/* @ */
+	0x3e, 0x41, 0x5d, 0x59, 0x4e, 0x00,
+	/* A */
+	0x7c, 0x12, 0x11, 0x12, 0x7c, 0x00,
+	/* B */
+	0x7f, 0x49, 0x49, 0x49, 0x36, 0x00,
+	/* C */
+	0x3e, 0x41, 0x41, 0x41, 0x22, 0x00,
+	/* D */
+	0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00,
+	/* E */
+	0x7f, 0x49, 0x49, 0x49, 0x41, 0x00,
+	/* F */
+	0x7f, 0x09, 0x09, 0x09, 0x01, 0x00,
+	/* G */
+	0x3e, 0x41, 0x41, 0x51, 0x73, 0x00,
+	/* H */
+	0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00,
+	/* I */
+	0x00, 0x41, 0x7f, 0x41, 0x00, 0x00,
+	/* J */
+	0x20, 0x40, 0x41, 0x3f, 0x01, 0x00,
+	/* K */
+	0x7f, 0x08, 0x14, 0x22, 0x41, 0x00,
+	/* L */
+	0x7f, 0x40, 0x40, 0x40, 0x40, 0x00,
+	/* M */
+	0x7f, 0x02, 0x1c, 0x02, 0x7f, 0x00,
+	/* N */
+	0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00,
+	/* O */
+	0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00,
+	/* P */
+	0x7f, 0x09, 0x09, 0x09, 0x06, 0x00,
+	/* Q */
+	0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00,
+	/* R */
+	0x7f, 0x09, 0x19, 0x29, 0x46, 0x00,
+	/* S */
+	0x26, 0x49, 0x49, 0x49, 0x32, 0x00,
+	/* T */
+	0x03, 0x01, 0x7f, 0x01, 0x03, 0x00,
+	/* U */
+	0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00,
+	/* V */
+	0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00,
+	/* W */
+	0x3f, 0x40, 0x38, 0x40, 0x3f, 0x00,
+	/* X */
+	0x63, 0x14, 0x08, 0x14, 0x63, 0x00,
+	/* Y */
+	0x03, 0x04, 0x78, 0x04, 0x03, 0x00,
+	/* Z */
+	0x61, 0x59, 0x49, 0x4d, 0x43, 0x00,
+	/* [ */
+	0x00, 0x7f, 0x41, 0x41, 0x41, 0x00,
+	/* \ */
+	0x02, 0x04, 0x08, 0x10, 0x20, 0x00,
+	/* ] */
+	0x00, 0x41, 0x41, 0x41, 0x7f, 0x00,
+	/* ^ */
+	0x04, 0x02, 0x01, 0x02, 0x04, 0x00,
+	/* _ */
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+	/* ` */
+	0x00, 0x03, 0x07, 0x08, 0x00, 0x00,
+	/* a */
+	0x20, 0x54, 0x54, 0x78, 0x40, 0x00,
+	/* b */
+	0x7f, 0x28, 0x44, 0x44, 0x38, 0x00,
+	/* c */
+	0x38, 0x44, 0x44, 0x44, 0x28, 0x00,
+	/* d */
+	0x38, 0x44, 0x44, 0x28, 0x7f, 0x00,
+	/* e */
+	0x38, 0x54, 0x54, 0x54, 0x18, 0x00,
+	/* f */
+	0x00, 0x08, 0x7e, 0x09, 0x02, 0x00,
+	/* g */
+	0x18, 0x24, 0x24, 0x1c, 0x78, 0x00,
+	/* h */
+	0x7f, 0x08, 0x04, 0x04, 0x78, 0x00,
+	/* i */
+	0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,
+	/* j */
+	0x20, 0x40, 0x40, 0x3d, 0x00, 0x00,
+	/* k */
+	0x7f, 0x10, 0x28, 0x44, 0x00, 0x00,
+	/* l */
+	0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,
+	/* m */
+	0x7c, 0x04, 0x78, 0x04, 0x78, 0x00,
+	/* n */
+	0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,
+	/* o */
+	0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+	/* p */
+	0x7c, 0x18, 0x24, 0x24, 0x18, 0x00,
+	/* q */
+	0x18, 0x24, 0x24, 0x18, 0x7c, 0x00,
+	/* r */
+	0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,
+	/* s */
+	0x48, 0x54, 0x54, 0x54, 0x24, 0x00,
+	/* t */
+	0x04, 0x04, 0x3f, 0x44, 0x24, 0x00,
+	/* u */
+	0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,
+	/* v */
+	0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,
+	/* w */
+	0x3c, 0x40, 0x30, 0x40, 0x3c, 0x00,
+	/* x */
+	0x44, 0x28, 0x10, 0x28, 0x44, 0x00,
+	/* y */
+	0x4c, 0x10, 0x10, 0x10, 0x7c, 0x00,
+	/* z */
+	0x44, 0x64, 0x54, 0x4c, 0x44, 0x00,
+	/* { */
+	0x00, 0x08, 0x36, 0x41, 0x00, 0x00,
+	/* | */
+	0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
+	/* } */
+	0x00, 0x41, 0x36, 0x08, 0x00, 0x00,
+	/* ~ */
+	0x02, 0x01, 0x02, 0x04, 0x02, 0x00,
+};
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file
+ *
+ * SSD1306 I2C transport: all writes go through the I2C transaction queue,
+ * so the display shares the bus with other devices. Frame data goes by DMA
+ * in chunks.
+ */
+
+#include "../inc/ssd1306_bus.h"
+#include "../inc/common.h"
+#include "../inc/i2c.h"
+#include "../inc/i2c_queue.h"
+
+#include "libprintf/printf.h"
+
+#include <errno.h>
+#include <stdint.h>
+
+/* Timeout for blocking command/data writes, msec */
+#define SSD1306_WRITE_TIMEOUT	100
+/* Flush is sent in chunks, so other I2C devices don't wait for whole frame */
+#define SSD1306_FLUSH_CHUNK	128
+
+/* Transactions of one flush window */
+struct ssd1306_i2c_win {
+	struct i2c_txn cmd_txn;
+	struct i2c_txn data_txn;
+	const struct ssd1306_win *win;
+};
+
+static struct ssd1306_i2c_win ssd1306_i2c_wins[SSD1306_PAGES];
+
+/* Blocking command/data writes */
+static struct i2c_txn ssd1306_sync_txn = {
+	.addr = SSD1306_I2C_ADDR,
+	.flags = I2C_XFER_REG,
+	.prio = I2C_PRIO_LOW,
+};
+
+static int ssd1306_i2c_init(const oled_ssd1306_t *obj)
+{
+	int ret;
+
+	ret = i2c_init(obj->i2c);
+	if (ret != 0)
+		return ret;
+
+	ret = i2c_detect_device(SSD1306_I2C_ADDR);
+	if (ret != 0)
+		printf("Cant find device on I2C bus, err = %d\n", ret);
+
+	return 0;
+}
+
+/* Write to the display through I2C queue and wait for completion */
+static int ssd1306_i2c_write(uint8_t dc, const uint8_t *buf, uint16_t len)
+{
+	int ret;
+
+	ssd1306_sync_txn.reg = dc;
+	ssd1306_sync_txn.tx_buf = buf;
+	ssd1306_sync_txn.tx_len = len;
+
+	ret = i2c_queue_submit(&ssd1306_sync_txn);
+	if (ret != 0)
+		return ret;
+
+	return i2c_queue_wait(&ssd1306_sync_txn, SSD1306_WRITE_TIMEOUT);
+}
+
+/* Window data went out (called from ISR) */
+static void ssd1306_i2c_done(struct i2c_txn *txn, void *data)
+{
+	struct ssd1306_i2c_win *iw = data;
+
+	ssd1306_flush_done(iw->win, txn->status);
+}
+
+static int ssd1306_i2c_flush(const struct ssd1306_win *win)
+{
+	struct ssd1306_i2c_win *iw = &ssd1306_i2c_wins[win->idx];
+	int ret;
+
+	iw->win = win;
+
+	iw->cmd_txn.addr = SSD1306_I2C_ADDR;
+	iw->cmd_txn.flags = I2C_XFER_REG;
+	iw->cmd_txn.reg = COMMAND;
+	iw->cmd_txn.prio = I2C_PRIO_LOW;
+	iw->cmd_txn.tx_buf = win->cmds;
+	iw->cmd_txn.tx_len = win->cmd_len;
+
+	iw->data_txn.addr = SSD1306_I2C_ADDR;
+	iw->data_txn.flags = I2C_XFER_REG | I2C_XFER_DMA;
+	iw->data_txn.reg = DATAONLY;
+	iw->data_txn.prio = I2C_PRIO_LOW;
+	iw->data_txn.tx_buf = win->data;
+	iw->data_txn.tx_len = win->len;
+	iw->data_txn.chunk = SSD1306_FLUSH_CHUNK;
+	iw->data_txn.cb = ssd1306_i2c_done;
+	iw->data_txn.cb_data = iw;
+
+	ret = i2c_queue_submit(&iw->cmd_txn);
+	if (ret != 0)
+		return ret;
+
+	/* Orphan address commands are harmless: the next window sets its own */
+	return i2c_queue_submit(&iw->data_txn);
+}
+
+const struct ssd1306_bus ssd1306_i2c_bus = {
+	.name = "i2c",
+	.init = ssd1306_i2c_init,
+	.write = ssd1306_i2c_write,
+	.flush = ssd1306_i2c_flush,
+};
@@ -0,0 +1,131 @@
+/* Generated by tools/icon_compiler.py, do not edit */
+
+#include "../inc/oled_ssd1306.h"
+
+/* alarm_high.png: 12x12, 22 bytes (RLE), unpacked 24 */
+static const uint8_t icon_alarm_high_data[] = {
+	0x0b, 0x00, 0x80, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0x80,
+	0x00, 0x81, 0x01, 0x03, 0x05, 0x0d, 0x0d, 0x05, 0x81, 0x01,
+};
+
+const bitmap_def_t icon_alarm_high = {
+	.width = 12,
+	.height = 12,
+	.data = icon_alarm_high_data,
+	.flags = BITMAP_RLE,
+};
+
+/* alarm_warn.png: 12x12, 22 bytes (RLE), unpacked 24 */
+static const uint8_t icon_alarm_warn_data[] = {
+	0x0b, 0x00, 0x80, 0x78, 0x04, 0x02, 0x01, 0x01, 0x02, 0x04, 0x78, 0x80,
+	0x00, 0x81, 0x01, 0x03, 0x05, 0x0d, 0x0d, 0x05, 0x81, 0x01,
+};
+
+const bitmap_def_t icon_alarm_warn = {
+	.width = 12,
+	.height = 12,
+	.data = icon_alarm_warn_data,
+	.flags = BITMAP_RLE,
+};
+
+/* battery_0.png: 12x12, 13 bytes (RLE), unpacked 24 */
+static const uint8_t icon_battery_0_data[] = {
+	0x00, 0xfc, 0x85, 0x04, 0x02, 0xfc, 0x70, 0x00, 0x87, 0x01, 0x01, 0x00,
+	0x00,
+};
+
+const bitmap_def_t icon_battery_0 = {
+	.width = 12,
+	.height = 12,
+	.data = icon_battery_0_data,
+	.flags = BITMAP_RLE,
+};
+
+/* battery_1.png: 12x12, 16 bytes (RLE), unpacked 24 */
+static const uint8_t icon_battery_1_data[] = {
+	0x03, 0xfc, 0x04, 0x74, 0x74, 0x82, 0x04, 0x02, 0xfc, 0x70, 0x00, 0x87,
+	0x01, 0x01, 0x00, 0x00,
+};
+
+const bitmap_def_t icon_battery_1 = {
+	.width = 12,
+	.height = 12,
+	.data = icon_battery_1_data,
+	.flags = BITMAP_RLE,
+};
+
+/* battery_2.png: 12x12, 16 bytes (RLE), unpacked 24 */
+static const uint8_t icon_battery_2_data[] = {
+	0x01, 0xfc, 0x04, 0x81, 0x74, 0x80, 0x04, 0x02, 0xfc, 0x70, 0x00, 0x87,
+	0x01, 0x01, 0x00, 0x00,
+};
+
+const bitmap_def_t icon_battery_2 = {
+	.width = 12,
+	.height = 12,
+	.data = icon_battery_2_data,
+	.flags = BITMAP_RLE,
+};
+
+/* battery_3.png: 12x12, 15 bytes (RLE), unpacked 24 */
+static const uint8_t icon_battery_3_data[] = {
+	0x01, 0xfc, 0x04, 0x83, 0x74, 0x03, 0x04, 0xfc, 0x70, 0x00, 0x87, 0x01,
+	0x01, 0x00, 0x00,
+};
+
+const bitmap_def_t icon_battery_3 = {
+	.width = 12,
+	.height = 12,
+	.data = icon_battery_3_data,
+	.flags = BITMAP_RLE,
+};
+
+/* link.png: 12x12, 20 bytes (RLE), unpacked 24 */
+static const uint8_t icon_link_data[] = {
+	0x03, 0x00, 0x04, 0x0e, 0x1f, 0x81, 0x04, 0x04, 0x84, 0x04, 0x04, 0x00,
+	0x00, 0x84, 0x02, 0x03, 0x0f, 0x07, 0x02, 0x00,
+};
+
+const bitmap_def_t icon_link = {
+	.width = 12,
+	.height = 12,
+	.data = icon_link_data,
+	.flags = BITMAP_RLE,
+};
+
+/* link_off.png: 12x12, 24 bytes, unpacked 24 */
+static const uint8_t icon_link_off_data[] = {
+	0x00, 0x04, 0x0e, 0x1f, 0x84, 0x44, 0x24, 0x14, 0x8c, 0x04, 0x02, 0x01,
+	0x08, 0x06, 0x02, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0f, 0x07, 0x02, 0x00,
+};
+
+const bitmap_def_t icon_link_off = {
+	.width = 12,
+	.height = 12,
+	.data = icon_link_off_data,
+};
+
+/* sensor_fault.png: 12x12, 24 bytes, unpacked 24 */
+static const uint8_t icon_sensor_fault_data[] = {
+	0x00, 0x00, 0xc0, 0x70, 0x1c, 0xe7, 0xe7, 0x1c, 0x70, 0xc0, 0x00, 0x00,
+	0x0c, 0x0f, 0x09, 0x08, 0x08, 0x0a, 0x0a, 0x08, 0x08, 0x09, 0x0f, 0x0c,
+};
+
+const bitmap_def_t icon_sensor_fault = {
+	.width = 12,
+	.height = 12,
+	.data = icon_sensor_fault_data,
+};
+
+/* sensor_ok.png: 12x12, 21 bytes (RLE), unpacked 24 */
+static const uint8_t icon_sensor_ok_data[] = {
+	0x11, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+	0x06, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0x83, 0x00,
+};
+
+const bitmap_def_t icon_sensor_ok = {
+	.width = 12,
+	.height = 12,
+	.data = icon_sensor_ok_data,
+	.flags = BITMAP_RLE,
+};
@@ -0,0 +1,242 @@
+/**
+ * @file
+ *
+ * SSD1306 SPI transport (4-wire: SCK, MOSI, CS, D/C, plus RST).
+ *
+ * The bus belongs to the display alone, so flush windows go back to back:
+ * address commands are written by CPU (6-8 bytes), then window data by DMA.
+ * The next window is started from the DMA interrupt. A full frame takes
+ * about 1 ms at 9 MHz, vs about 25 ms on 400 kHz I2C.
+ */
+
+#include "../inc/ssd1306_bus.h"
+#include "../inc/board.h"
+#include "../inc/common.h"
+#include "../inc/irq.h"
+
+#include <libopencm3/cm3/nvic.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/stm32/gpio.h>
+#include <libopencm3/stm32/spi.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Timeout for blocking writes to wait for the flush in flight, msec */
+#define SSD1306_WRITE_TIMEOUT	100
+
+struct ssd1306_spi {
+	struct irq_action dma_action;
+	/* Windows waiting for the bus */
+	const struct ssd1306_win *queue[SSD1306_PAGES];
+	uint8_t head;
+	uint8_t len;
+	/* Window being sent by DMA */
+	const struct ssd1306_win * volatile cur;
+	/* Blocking write owns the bus */
+	volatile bool sync;
+};
+
+static struct ssd1306_spi ssd1306_spi;
+
+/* Wait for the last byte to leave the shift register */
+static void ssd1306_spi_wait_idle(void)
+{
+	while (!(SPI_SR(OLED_SPI) & SPI_SR_TXE))
+		;
+	while (SPI_SR(OLED_SPI) & SPI_SR_BSY)
+		;
+}
+
+/* Send bytes by CPU; D/C must be set already */
+static void ssd1306_spi_send(const uint8_t *buf, uint16_t len)
+{
+	while (len--)
+		spi_send(OLED_SPI, *buf++);
+
+	ssd1306_spi_wait_idle();
+}
+
+/*
+ * Start the next queued window if the bus is free. Called with interrupts
+ * disabled or from ISR.
+ */
+static void ssd1306_spi_kick(void)
+{
+	struct ssd1306_spi *obj = &ssd1306_spi;
+	const struct ssd1306_win *win;
+
+	if (obj->cur || obj->sync || !obj->len)
+		return;
+
+	win = obj->queue[obj->head];
+	obj->head = (obj->head + 1) % SSD1306_PAGES;
+	obj->len--;
+	obj->cur = win;
+
+	gpio_clear(OLED_CS_PORT, OLED_CS_PIN);
+	gpio_clear(OLED_DC_PORT, OLED_DC_PIN);
+	ssd1306_spi_send(win->cmds, win->cmd_len);
+	gpio_set(OLED_DC_PORT, OLED_DC_PIN);
+
+	dma_set_memory_address(DMA1, OLED_SPI_DMA_CH, (uint32_t)win->data);
+	dma_set_number_of_data(DMA1, OLED_SPI_DMA_CH, win->len);
+	dma_enable_channel(DMA1, OLED_SPI_DMA_CH);
+	spi_enable_tx_dma(OLED_SPI);
+}
+
+/* DMA TX channel: window data is in SPI, finish the window */
+static irqreturn_t ssd1306_spi_dma_isr(int irq, void *data)
+{
+	struct ssd1306_spi *obj = data;
+	const struct ssd1306_win *win = obj->cur;
+	int status = 0;
+
+	UNUSED(irq);
+
+	if (dma_get_interrupt_flag(DMA1, OLED_SPI_DMA_CH, DMA_TEIF))
+		status = -EIO;
+
+	dma_clear_interrupt_flags(DMA1, OLED_SPI_DMA_CH,
+				  DMA_TEIF | DMA_TCIF | DMA_GIF);
+	dma_disable_channel(DMA1, OLED_SPI_DMA_CH);
+	spi_disable_tx_dma(OLED_SPI);
+
+	if (!win)
+		return IRQ_NONE;
+
+	/* Up to 2 bytes are still in SPI: about 2 us at 9 MHz */
+	ssd1306_spi_wait_idle();
+	gpio_set(OLED_CS_PORT, OLED_CS_PIN);
+
+	obj->cur = NULL;
+	ssd1306_flush_done(win, status);
+	ssd1306_spi_kick();
+
+	return IRQ_HANDLED;
+}
+
+/* Take the bus for blocking write, if no window is going out */
+static bool ssd1306_spi_claim(void)
+{
+	struct ssd1306_spi *obj = &ssd1306_spi;
+	unsigned long flags;
+	bool ret = false;
+
+	enter_critical(flags);
+	if (!obj->cur) {
+		obj->sync = true;
+		ret = true;
+	}
+	exit_critical(flags);
+
+	return ret;
+}
+
+static int ssd1306_spi_write(uint8_t dc, const uint8_t *buf, uint16_t len)
+{
+	unsigned long flags;
+
+	if (wait_event_timeout(ssd1306_spi_claim(), SSD1306_WRITE_TIMEOUT))
+		return -ETIMEDOUT;
+
+	gpio_clear(OLED_CS_PORT, OLED_CS_PIN);
+	if (dc == DATAONLY)
+		gpio_set(OLED_DC_PORT, OLED_DC_PIN);
+	else
+		gpio_clear(OLED_DC_PORT, OLED_DC_PIN);
+	ssd1306_spi_send(buf, len);
+	gpio_set(OLED_CS_PORT, OLED_CS_PIN);
+
+	/* Windows queued meanwhile go now */
+	enter_critical(flags);
+	ssd1306_spi.sync = false;
+	ssd1306_spi_kick();
+	exit_critical(flags);
+
+	return 0;
+}
+
+static int ssd1306_spi_flush(const struct ssd1306_win *win)
+{
+	struct ssd1306_spi *obj = &ssd1306_spi;
+	unsigned long flags;
+	int ret = 0;
+
+	enter_critical(flags);
+	if (obj->len == SSD1306_PAGES) {
+		ret = -ENOSPC;
+	} else {
+		obj->queue[(obj->head + obj->len) % SSD1306_PAGES] = win;
+		obj->len++;
+		ssd1306_spi_kick();
+	}
+	exit_critical(flags);
+
+	return ret;
+}
+
+/* RES# low for at least 3 us; ssd1306_init() waits for the panel after */
+static void ssd1306_spi_reset(void)
+{
+	gpio_clear(OLED_RST_PORT, OLED_RST_PIN);
+	udelay(10);
+	gpio_set(OLED_RST_PORT, OLED_RST_PIN);
+}
+
+static int ssd1306_spi_init(const oled_ssd1306_t *obj)
+{
+	struct ssd1306_spi *spi = &ssd1306_spi;
+	uint8_t ch = OLED_SPI_DMA_CH;
+	int ret;
+
+	UNUSED(obj);
+
+	spi->head = 0;
+	spi->len = 0;
+	spi->cur = NULL;
+	spi->sync = false;
+
+	gpio_set(OLED_CS_PORT, OLED_CS_PIN);
+	gpio_set(OLED_RST_PORT, OLED_RST_PIN);
+
+	/* Mode 0, MSB first; CS is driven by software */
+	spi_reset(OLED_SPI);
+	spi_init_master(OLED_SPI, OLED_SPI_BR, SPI_CR1_CPOL_CLK_TO_0_WHEN_IDLE,
+			SPI_CR1_CPHA_CLK_TRANSITION_1, SPI_CR1_DFF_8BIT,
+			SPI_CR1_MSBFIRST);
+	spi_enable_software_slave_management(OLED_SPI);
+	spi_set_nss_high(OLED_SPI);
+	spi_enable(OLED_SPI);
+
+	dma_channel_reset(DMA1, ch);
+	dma_set_peripheral_address(DMA1, ch, (uint32_t)&SPI_DR(OLED_SPI));
+	dma_set_read_from_memory(DMA1, ch);
+	dma_enable_memory_increment_mode(DMA1, ch);
+	dma_set_peripheral_size(DMA1, ch, DMA_CCR_PSIZE_8BIT);
+	dma_set_memory_size(DMA1, ch, DMA_CCR_MSIZE_8BIT);
+	dma_set_priority(DMA1, ch, DMA_CCR_PL_MEDIUM);
+	dma_enable_transfer_complete_interrupt(DMA1, ch);
+	dma_enable_transfer_error_interrupt(DMA1, ch);
+
+	spi->dma_action.handler = ssd1306_spi_dma_isr;
+	spi->dma_action.irq = OLED_SPI_DMA_IRQ;
+	spi->dma_action.name = "oled_dma";
+	spi->dma_action.data = spi;
+	ret = irq_request(&spi->dma_action);
+	if (ret)
+		return ret;
+
+	nvic_enable_irq(OLED_SPI_DMA_IRQ);
+
+	return 0;
+}
+
+const struct ssd1306_bus ssd1306_spi_bus = {
+	.name = "spi",
+	.init = ssd1306_spi_init,
+	.reset = ssd1306_spi_reset,
+	.write = ssd1306_spi_write,
+	.flush = ssd1306_spi_flush,
+};
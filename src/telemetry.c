@@ -0,0 +1,231 @@
+/**
+ * @file
+ *
+ * Binary telemetry stream to the host.
+ *
+ * Records are small typed binary frames instead of printf() text: a CO2
+ * sample costs 13 bytes on the wire. Each record carries sequence number, so
+ * the host can see lost frames, and CRC16. Frames are COBS encoded, so 0x00
+ * never appears inside a frame and is used as delimiter: the host can
+ * resynchronize at any byte.
+ *
+ * Frames are queued into the serial TX FIFO and sent by interrupts; when the
+ * FIFO is full the frame is dropped (and counted) rather than waited for.
+ */
+
+#include "telemetry.h"
+#include "modbus.h"
+#include "serial.h"
+#include "common.h"
+#include <errno.h>
+#include <stddef.h>
+
+struct telemetry {
+	uint32_t usart;
+	uint8_t seq;
+	uint32_t drops;
+	uint8_t raw[TELEMETRY_RAW_MAX];
+	uint8_t frame[TELEMETRY_FRAME_MAX];
+};
+
+static struct telemetry tlm;
+
+static uint8_t *telemetry_put16(uint8_t *p, uint16_t val)
+{
+	*p++ = val & 0xff;
+	*p++ = val >> 8;
+	return p;
+}
+
+static uint8_t *telemetry_put32(uint8_t *p, uint32_t val)
+{
+	p = telemetry_put16(p, val & 0xffff);
+	return telemetry_put16(p, val >> 16);
+}
+
+/**
+ * COBS encode buffer (delimiter is not appended).
+ *
+ * @param src Data to encode
+ * @param len Data length, in bytes
+ * @param[out] dst Encoded data; len + len / 254 + 1 bytes at most
+ * @return Encoded length, in bytes
+ */
+uint16_t telemetry_cobs_encode(const uint8_t *src, uint16_t len, uint8_t *dst)
+{
+	uint16_t code_idx = 0;	/* where code byte of current block goes */
+	uint16_t out = 1;
+	uint8_t code = 1;
+	uint16_t i;
+
+	for (i = 0; i < len; ++i) {
+		if (src[i] != 0) {
+			dst[out++] = src[i];
+			code++;
+		}
+
+		if (src[i] == 0 || code == 0xff) {
+			dst[code_idx] = code;
+			code_idx = out++;
+			code = 1;
+		}
+	}
+	dst[code_idx] = code;
+
+	return out;
+}
+
+/**
+ * Send telemetry record.
+ *
+ * Must be called from task context only.
+ *
+ * @param type Record type, enum telemetry_type
+ * @param payload Record payload
+ * @param len Payload length, in bytes
+ * @return 0 on success or negative value on error
+ */
+int telemetry_send(uint8_t type, const uint8_t *payload, uint16_t len)
+{
+	struct telemetry *obj = &tlm;
+	uint16_t raw_len, frame_len, crc, i;
+
+	if (!obj->usart)
+		return -ENODEV;
+	if (len > TELEMETRY_PAYLOAD_MAX)
+		return -EINVAL;
+
+	obj->raw[0] = type;
+	obj->raw[1] = obj->seq++;
+	for (i = 0; i < len; ++i)
+		obj->raw[2 + i] = payload[i];
+	raw_len = 2 + len;
+	crc = modbus_crc16(obj->raw, raw_len);
+	telemetry_put16(obj->raw + raw_len, crc);
+	raw_len += 2;
+
+	frame_len = telemetry_cobs_encode(obj->raw, raw_len, obj->frame);
+	obj->frame[frame_len++] = TELEMETRY_DELIM;
+
+	if (serial_send_fifo(obj->usart, obj->frame, frame_len) < 0) {
+		obj->drops++;
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
+/**
+ * Send sensor sample record.
+ *
+ * @param sensor Sensor index on the bus
+ * @param co2 CO2 concentration, ppm
+ * @param status Sensor meter status
+ * @param temp Temperature, 0.01 degC, or TELEMETRY_TEMP_NA
+ * @return 0 on success or negative value on error
+ */
+int telemetry_send_sample(uint8_t sensor, uint16_t co2, uint16_t status,
+			  int16_t temp)
+{
+	uint8_t buf[7];
+	uint8_t *p = buf;
+
+	*p++ = sensor;
+	p = telemetry_put16(p, co2);
+	p = telemetry_put16(p, status);
+	p = telemetry_put16(p, temp);
+
+	return telemetry_send(TELEMETRY_SAMPLE, buf, p - buf);
+}
+
+/**
+ * Send statistics record.
+ *
+ * @param stats Statistics; "drops" field is filled by telemetry itself
+ * @return 0 on success or negative value on error
+ */
+int telemetry_send_stats(const struct telemetry_stats *stats)
+{
+	uint8_t buf[32];
+	uint8_t *p = buf;
+
+	p = telemetry_put32(p, stats->uptime);
+	p = telemetry_put16(p, stats->bus_rate);
+	p = telemetry_put32(p, stats->bus_requests);
+	p = telemetry_put32(p, stats->bus_timeouts);
+	p = telemetry_put32(p, stats->bus_errors);
+	p = telemetry_put32(p, stats->line_errors);
+	p = telemetry_put32(p, stats->rx_drops);
+	p = telemetry_put16(p, stats->rx_hwm);
+	p = telemetry_put32(p, tlm.drops);
+
+	return telemetry_send(TELEMETRY_STATS, buf, p - buf);
+}
+
+/**
+ * Send statistics record of one sensors bus slave.
+ *
+ * @param slave Slave statistics
+ * @return 0 on success or negative value on error
+ */
+int telemetry_send_bus_slave(const struct telemetry_bus_slave *slave)
+{
+	uint8_t buf[34];
+	uint8_t *p = buf;
+
+	*p++ = slave->sensor;
+	*p++ = slave->addr;
+	p = telemetry_put32(p, slave->requests);
+	p = telemetry_put32(p, slave->replies);
+	p = telemetry_put32(p, slave->timeouts);
+	p = telemetry_put32(p, slave->errors);
+	p = telemetry_put32(p, slave->latency_last);
+	p = telemetry_put32(p, slave->latency_min);
+	p = telemetry_put32(p, slave->latency_max);
+	p = telemetry_put32(p, slave->latency_avg);
+
+	return telemetry_send(TELEMETRY_BUS_SLAVE, buf, p - buf);
+}
+
+/**
+ * Send event record.
+ *
+ * @param code Event code, enum telemetry_event
+ * @param arg Event argument
+ * @return 0 on success or negative value on error
+ */
+int telemetry_send_event(uint8_t code, uint32_t arg)
+{
+	uint8_t buf[5];
+
+	buf[0] = code;
+	telemetry_put32(buf + 1, arg);
+
+	return telemetry_send(TELEMETRY_EVENT, buf, sizeof(buf));
+}
+
+/* Frames dropped because serial TX FIFO was full */
+uint32_t telemetry_get_drops(void)
+{
+	return tlm.drops;
+}
+
+/**
+ * Initialize telemetry stream.
+ *
+ * @param usart Serial port, must be initialized already
+ * @return 0 on success or negative value on error
+ */
+int telemetry_init(uint32_t usart)
+{
+	struct telemetry *obj = &tlm;
+
+	if (!usart)
+		return -EINVAL;
+
+	obj->usart = usart;
+	obj->seq = 0;
+	obj->drops = 0;
+
+	return 0;
+}
@@ -16,10 +16,20 @@
 #include "../inc/serial.h"
 #include "../inc/fifo.h"
 #include "../inc/i2c.h"
+#include "../inc/i2c_queue.h"
 #include "../inc/oled_ssd1306.h"
+#include "../inc/ui.h"
+#include "../inc/ssd1306_icons.h"
+#include "../inc/ssd1306_bus.h"
 //#include "../inc/ssd1306_fonts.h"
 #include "../inc/errors.h"
 #include "../inc/debug.h"
+#include "../inc/modbus.h"
+#include "../inc/s8.h"
+#include "../inc/modbus_master.h"
+#include "../inc/modbus_slave.h"
+#include "../inc/telemetry.h"
+#include "../inc/oled_mirror.h"
 //#include "../inc/backup.h"
 //#include "../inc/rtc.h"
 
@@ -32,12 +42,40 @@
 
 #define DEBUG  1
 #define GET_CO2_DELAY 5000
+/* CO2 trend under the readout: one column per GET_CO2_DELAY */
+#define CO2_CHART_Y	40
+#define CO2_CHART_H	(SSD1306_HEIGHT - CO2_CHART_Y)
+#define CO2_CHART_STEP	100	/* ppm */
+#define CO2_DIGITS	4
+/* Alarm icon levels */
+#define CO2_WARN_PPM	1000
+#define CO2_ALARM_PPM	1400
+#define ICON_SIZE	12
 
 static void show_co2(void *param);
+static void main_screen_init(void);
 static void blink_led(void *param);
+static void s8_sample_ready(int idx, uint8_t addr,
+			    const struct s8_sample *sample, void *data);
 
 //extern uint32_t serial_usart;
-static oled_ssd1306_t oled_disp;
+
+/* Main screen: CO2 readout, sensor status and trend */
+static struct ui_screen main_screen;
+static struct ui_label co2_label;
+static struct ui_number co2_value;
+static struct ui_label status_label;
+static struct ui_icon sensor_icon;
+static struct ui_icon alarm_icon;
+static struct ui_chart co2_chart;
+
+/*
+ * S8 sensors on RS-485 bus. Each one needs its own address on multi-drop bus;
+ * MODBUS_ADDR_ANY only works for a single sensor.
+ */
+static const uint8_t s8_slaves[] = { MODBUS_ADDR_ANY };
+/* Last meter status of each sensor, to report faults as events */
+static uint16_t s8_status[ARRAY_SIZE(s8_slaves)];
 
 static void init (void) {
     int err;
@@ -56,10 +94,51 @@ static void init (void) {
 		.stopbits = USART_STOPBITS_1,
 		.parity = USART_PARITY_NONE,
 		.mode = USART_MODE_TX_RX,
-		.flow_control = USART_FLOWCONTROL_NONE
+		.flow_control = USART_FLOWCONTROL_NONE,
+		.de_port = RS485_DE_PORT,
+		.de_pin = RS485_DE_PIN,
+		.rx_cb = modbus_master_rx,
+		.tc_cb = modbus_master_tc,
+	};
+
+	const struct modbus_master_cfg bus = {
+		.usart = SERIAL_USART,
+		.baud = 9600,
+		.slaves = s8_slaves,
+		.slave_nr = ARRAY_SIZE(s8_slaves),
+		.retries = 1,
+		.timeout = 100,
+		.backoff_max = 10000,
+		.cb = s8_sample_ready,
+	};
+
+	/* Host link: binary telemetry stream or Modbus slave for PLC/SCADA */
+	struct serial_device host = {
+		.uart = HOST_USART,
+		.baud = HOST_BAUD,
+		.bits = 8,
+		.stopbits = USART_STOPBITS_1,
+		.parity = USART_PARITY_NONE,
+		.mode = USART_MODE_TX_RX,
+		.flow_control = USART_FLOWCONTROL_NONE,
+		.de_port = HOST_DE_PORT,
+		.de_pin = HOST_DE_PIN,
+#if !USE_TELEMETRY
+		.idle_cb = modbus_slave_idle,
+#endif
+	};
+
+	const struct modbus_slave_cfg host_slave = {
+		.usart = HOST_USART,
+		.addr = HOST_MODBUS_ADDR,
 	};
 
 	oled_ssd1306_t oled_disp = {
+#if USE_OLED_SPI
+		.bus = &ssd1306_spi_bus,
+#else
+		.bus = &ssd1306_i2c_bus,
+#endif
 		.i2c = I2C1,
 		.addr = SSD1306_I2C_ADDR,
 		.x_pos = 0,
@@ -83,15 +162,65 @@ static void init (void) {
 		hang();
 	}
 
+	err = i2c_queue_init();
+	if (err) {
+		logmsg("Can't initialize I2C queue\n");
+		hang();
+	}
+
 	ssd1306_init(&oled_disp);
+	main_screen_init();
+
+	err = s8_init();
+	if (err) {
+		logmsg("Can't build S8 register map\n");
+		hang();
+	}
+
+	err = modbus_master_init(&bus);
+	if (err) {
+		logmsg("Can't initialize Modbus master\n");
+		hang();
+	}
 
 
+	err = modbus_slave_init(&host_slave);
+	if (err) {
+		logmsg("Can't initialize Modbus slave\n");
+		hang();
+	}
+	modbus_slave_set_holding(MODBUS_HR_BUS_SLAVES, ARRAY_SIZE(s8_slaves));
+	serial_init(&host);
+
+#if USE_TELEMETRY
+	err = telemetry_init(HOST_USART);
+	if (err) {
+		logmsg("Can't initialize telemetry\n");
+		hang();
+	}
+	telemetry_send_event(TELEMETRY_EV_BOOT, 0);
+#endif
+
 	err = swtimer_init(&hw_tim);
 	if (err) {
 		logmsg("Can't initialize swtimer\n");
 		hang();
 	}
 
+	err = ui_init(UI_FPS_DEFAULT);
+	if (err) {
+		logmsg("Can't initialize UI\n");
+		hang();
+	}
+
+#if USE_TELEMETRY && USE_OLED_MIRROR
+	err = oled_mirror_init(HOST_USART);
+	if (err) {
+		logmsg("Can't initialize display mirroring\n");
+		hang();
+	}
+#endif
+
     /* Register timer for CO2 sensor */
     int co2_tim_id;
 
@@ -112,87 +241,178 @@ static void init (void) {
     gpio_set(LED_PORT,LED_PIN);     // PC13 = on
 }
 
+#if USE_TELEMETRY
+/* Send latency and error statistics of one sensor to the host */
+static void send_bus_slave(int idx, uint8_t addr)
+{
+	struct telemetry_bus_slave rec = {
+		.sensor = idx,
+		.addr = addr,
+	};
+	struct modbus_slave_stats st;
+
+	if (modbus_master_get_stats(idx, &st))
+		return;
+
+	rec.requests = st.requests;
+	rec.replies = st.replies;
+	rec.timeouts = st.timeouts;
+	rec.errors = st.bad_frames + st.exceptions;
+	rec.latency_last = st.latency_last;
+	rec.latency_min = st.latency_min;
+	rec.latency_max = st.latency_max;
+	rec.latency_avg = st.latency_avg;
+
+	telemetry_send_bus_slave(&rec);
+}
+#endif
+
+/* Publish fresh S8 data and bus statistics to the Modbus slave image */
+static void s8_sample_ready(int idx, uint8_t addr,
+			    const struct s8_sample *sample, void *data)
+{
+	struct modbus_slave_stats st;
+	uint32_t requests = 0, timeouts = 0, errors = 0;
+	size_t i;
+
+	UNUSED(addr);
+	UNUSED(data);
+
+	for (i = 0; i < ARRAY_SIZE(s8_slaves); ++i) {
+		if (modbus_master_get_stats(i, &st))
+			continue;
+		requests += st.requests;
+		timeouts += st.timeouts;
+		errors += st.bad_frames + st.exceptions;
+	}
+	modbus_slave_set_input32(MODBUS_IR_BUS_REQUESTS_HI, requests);
+	modbus_slave_set_input32(MODBUS_IR_BUS_TIMEOUTS_HI, timeouts);
+	modbus_slave_set_input32(MODBUS_IR_BUS_ERRORS_HI, errors);
+	modbus_slave_set_input(MODBUS_IR_BUS_RATE, modbus_master_get_rate());
+	modbus_slave_set_input32(MODBUS_IR_UPTIME_HI,
+				 systick_get_time_ms() / 1000);
+
+#if USE_TELEMETRY
+	telemetry_send_sample(idx, sample->co2, sample->meter_status,
+			      TELEMETRY_TEMP_NA);
+	send_bus_slave(idx, addr);
+	if (sample->meter_status != s8_status[idx]) {
+		if (sample->meter_status)
+			telemetry_send_event(TELEMETRY_EV_SENSOR_FAULT,
+					     ((uint32_t)idx << 16) |
+					     sample->meter_status);
+		else
+			telemetry_send_event(TELEMETRY_EV_SENSOR_OK, idx);
+	}
+#endif
+	s8_status[idx] = sample->meter_status;
+
+	if (idx != 0)
+		return;
+
+	modbus_slave_set_input(MODBUS_IR_CO2, sample->co2);
+	modbus_slave_set_input(MODBUS_IR_METER_STATUS, sample->meter_status);
+	modbus_slave_set_input(MODBUS_IR_ALARM_STATUS, sample->alarm_status);
+	if (sample->valid & BIT(S8_TYPE_ID_HI)) {
+		modbus_slave_set_holding(MODBUS_HR_S8_TYPE_ID_HI,
+					 sample->type_id_hi);
+		modbus_slave_set_holding(MODBUS_HR_S8_TYPE_ID_LO,
+					 sample->type_id_lo);
+	}
+	if (sample->valid & BIT(S8_FW_VERSION))
+		modbus_slave_set_holding(MODBUS_HR_S8_FW_VERSION,
+					 sample->fw_version);
+	if (sample->valid & BIT(S8_ABC_PERIOD))
+		modbus_slave_set_holding(MODBUS_HR_S8_ABC_PERIOD,
+					 sample->abc_period);
+}
+
+#if USE_TELEMETRY
+/* Send bus and line statistics record to the host */
+static void send_stats(const struct serial_stats *line)
+{
+	struct telemetry_stats st = {
+		.uptime = systick_get_time_ms(),
+		.bus_rate = modbus_master_get_rate(),
+		.line_errors = line->noise + line->overrun + line->frame +
+			       line->parity,
+		.rx_drops = line->rx_drops,
+		.rx_hwm = line->rx_hwm,
+	};
+	struct modbus_slave_stats bus;
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE(s8_slaves); ++i) {
+		if (modbus_master_get_stats(i, &bus))
+			continue;
+		st.bus_requests += bus.requests;
+		st.bus_timeouts += bus.timeouts;
+		st.bus_errors += bus.bad_frames + bus.exceptions;
+	}
+
+	telemetry_send_stats(&st);
+}
+#endif
+
+static void main_screen_init(void)
+{
+	ui_label_init(&co2_label, 0, 0, 0, &font_16x26, "CO2:");
+	ui_number_init(&co2_value, 64, 0, CO2_DIGITS, &font_16x26);
+	ui_label_init(&status_label, 0, 27, 0, &font_7x10, "Status:");
+	ui_icon_init(&sensor_icon, 52, 27, ICON_SIZE, ICON_SIZE, NULL);
+	ui_icon_init(&alarm_icon, 70, 27, ICON_SIZE, ICON_SIZE, NULL);
+	ui_chart_init(&co2_chart, 0, CO2_CHART_Y, SSD1306_WIDTH, CO2_CHART_H,
+		      CO2_CHART_STEP);
+
+	ui_screen_add(&main_screen, &co2_label.base);
+	ui_screen_add(&main_screen, &co2_value.base);
+	ui_screen_add(&main_screen, &status_label.base);
+	ui_screen_add(&main_screen, &sensor_icon.base);
+	ui_screen_add(&main_screen, &alarm_icon.base);
+	ui_screen_add(&main_screen, &co2_chart.base);
+	ui_show(&main_screen);
+}
+
 static void show_co2(void *param)
 {
 	UNUSED(param);
-//	err_t fifo_err = EOK;
-//	unsigned long flags;
-
-	// Request of the CO2 value from Sensair S8 sensor
-//	uint8_t buf[] = {0xfe, 0x44, 0, 0x08, 0x02, 0x9f, 0x25};
-
-// Request value of the CO2 and status information from Sensair S8 sensor
-// Master Transmit:
-//	<FE> <04> <00> <00> <00> <04> <E5> <C6>
-// Slave Reply:
-//	<FE> <04> <08> <00> <00> <00> <00> <00> <00> <01> <90> <16> <E6>
-// 					   | Status  | 				|   CO2   |
- uint8_t buf[] = {0xfe, 0x04, 0, 0, 0, 0x04, 0xe5, 0xc6};
-
-//	uint8_t  s;
-//	logmsg("Send through UART1:\n");	
-//	for (s = 0; s < ARRAY_SIZE(buf); s++){
-//		logmsg("0x%x ", buf[s]);
-//	};
-//	logmsg("\n");
-
-	serial_send_fifo(serial_usart, buf, ARRAY_SIZE(buf));
-
-	mdelay(100);
-
-	uint8_t rcv[20];
-	int8_t rcv_len = 0;
-	rcv_len = serial_receive_fifo(serial_usart, rcv, 20);
-
-//	uint8_t s;
-//	logmsg("Received from UART1: %d byte\n", rcv_len);
-//	for (s = 0; s <= rcv_len;  s++ ){
-//		logmsg("0x%x ", rcv[s]);
-//	};
-//	logmsg("\n");
-
-	uint16_t co2=0;
-//	co2 = 256 * rcv[3] + rcv[4]; // In case you read only CO2 value from S8
-	co2 = (rcv[9] << 8) + rcv[10];
-
-	uint16_t status;	
-	status = (rcv[4] << 8) + rcv[5];
-
-
-	uint8_t rem, i=0;
-	char str[5];
-
-	while (co2) {
-			rem = co2 % 10;
-			str[i++] = rem + '0';
-			co2 /= 10;
-	}
-   	str[i] = '\0'; // Indicating end of line
-
-	inplace_reverse(str);
-
-	logmsg("CO2 = %s, Status = %d \n", str, status);
-	
-//	ssd1306_draw_pixel(10, 10, WHITE);
-//	ssd1306_draw_pixel(10, 12, WHITE);
-//	s = ssd1306_write_char(&oled_disp, '$', font_16x26, WHITE);
- 	ssd1306_set_cursor(&oled_disp, 0, 0);
-	ssd1306_write_string(&oled_disp, "CO2:", font_16x26, WHITE);
-	// Clear previous value of CO2
-	ssd1306_write_string(&oled_disp, "     ", font_16x26, WHITE);
- 	ssd1306_set_cursor(&oled_disp, 64, 0);
-	ssd1306_write_string(&oled_disp, str, font_16x26, WHITE);
-
-
-	// Status value
- 	ssd1306_set_cursor(&oled_disp, 0, 27);
-	ssd1306_write_string(&oled_disp, "Status:", font_7x10, WHITE);
- 	ssd1306_set_cursor(&oled_disp, 50, 27);
-	ssd1306_write_string(&oled_disp, "   ", font_7x10, WHITE);
- 	ssd1306_set_cursor(&oled_disp, 50, 27);
-	ssd1306_write_string(&oled_disp, ((status==0) ? " Ok": "Err"), font_7x10, WHITE);
-	
-	ssd1306_update_screen();
+	struct s8_sample sample;
+	struct serial_stats line;
+
+	/* Sensors are polled in background; show the first one */
+	modbus_master_get_sample(0, &sample);
+	logmsg("S8 bus: %lu samples/s\n", modbus_master_get_rate());
+	if (!serial_get_stats(SERIAL_USART, &line)) {
+		logmsg("S8 line: rx %lu tx %lu, ne %lu ore %lu fe %lu pe %lu, "
+		       "drops %lu, rx hwm %u\n", line.rx_bytes, line.tx_bytes,
+		       line.noise, line.overrun, line.frame, line.parity,
+		       line.rx_drops, line.rx_hwm);
+	}
+#if USE_TELEMETRY
+	send_stats(&line);
+#endif
+
+	uint16_t status = sample.meter_status;
+
+	logmsg("CO2 = %u, Status = %u\n", sample.co2, status);
+
+	/* Widgets redraw only what changed, on the next UI frame */
+	if (!(sample.valid & BIT(S8_SPACE_CO2))) {
+		ui_number_clear(&co2_value);
+		return;
+	}
+
+	ui_number_set(&co2_value, sample.co2);
+	ui_icon_set(&sensor_icon,
+		    (status == 0) ? &icon_sensor_ok : &icon_sensor_fault);
+	if (sample.co2 >= CO2_ALARM_PPM)
+		ui_icon_set(&alarm_icon, &icon_alarm_high);
+	else if (sample.co2 >= CO2_WARN_PPM)
+		ui_icon_set(&alarm_icon, &icon_alarm_warn);
+	else
+		ui_icon_set(&alarm_icon, NULL);
+	if (status == 0)
+		ui_chart_add(&co2_chart, sample.co2);
 }
 
 static void blink_led(void * param) {
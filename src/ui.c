@@ -0,0 +1,429 @@
+/**
+ * @file
+ *
+ * Retained-mode UI on top of the SSD1306 framebuffer.
+ *
+ * Widgets keep their state and mark themselves dirty only when a value
+ * really changes. Dirty widgets are redrawn and the frame is presented by
+ * a periodic swtimer, so any number of updates between two ticks end up
+ * in one flush: the display never gets more than "fps" frames per second.
+ */
+
+#include "../inc/ui.h"
+#include "../inc/swtimer.h"
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+struct ui {
+	struct ui_screen *screen;	/* shown now */
+	oled_ssd1306_t cursor;		/* text position for the driver */
+	bool frame_pending;		/* something changed since last frame */
+	uint32_t frames;		/* frames presented */
+	int tim_id;
+};
+
+static struct ui ui;
+
+static bool ui_widget_shown(const struct ui_widget *w)
+{
+	const struct ui_widget *cur;
+
+	if (!ui.screen)
+		return false;
+	for (cur = ui.screen->first; cur; cur = cur->next) {
+		if (cur == w)
+			return true;
+	}
+
+	return false;
+}
+
+static void ui_clear(const struct ui_widget *w)
+{
+	ssd1306_fill_rectangle(w->x, w->y, w->x + w->w - 1, w->y + w->h - 1,
+			       BLACK);
+}
+
+/* Frame tick: redraw what changed and present it (task context) */
+static void ui_tick(void *data)
+{
+	struct ui_widget *w;
+
+	UNUSED(data);
+
+	if (!ui.frame_pending || !ui.screen)
+		return;
+
+	for (w = ui.screen->first; w; w = w->next) {
+		if (w->dirty) {
+			w->draw(w);
+			w->dirty = false;
+			w->damaged = false;
+		}
+	}
+
+	/* Previous frame still going out: this one goes on the next tick */
+	if (ssd1306_present(NULL, NULL) == 0) {
+		ui.frame_pending = false;
+		ui.frames++;
+	}
+}
+
+/**
+ * Start frame scheduler.
+ *
+ * @param fps Max frames per second
+ * @return 0 on success or negative value on error
+ */
+int ui_init(uint8_t fps)
+{
+	int period;
+
+	if (!fps)
+		return -EINVAL;
+
+	period = 1000 / fps;
+	if (period < SWTIMER_HW_OVERFLOW)
+		period = SWTIMER_HW_OVERFLOW;
+
+	ui.tim_id = swtimer_tim_register(ui_tick, NULL, period);
+	if (ui.tim_id < 0)
+		return -ENOMEM;
+
+	return 0;
+}
+
+void ui_screen_add(struct ui_screen *scr, struct ui_widget *w)
+{
+	w->next = NULL;
+	if (scr->last)
+		scr->last->next = w;
+	else
+		scr->first = w;
+	scr->last = w;
+
+	if (scr == ui.screen)
+		ui_invalidate(w);
+}
+
+/* Switch to the screen: everything is drawn from scratch */
+void ui_show(struct ui_screen *scr)
+{
+	struct ui_widget *w;
+
+	ui.screen = scr;
+	ssd1306_fill(BLACK);
+	for (w = scr->first; w; w = w->next) {
+		w->dirty = true;
+		w->damaged = true;
+	}
+	ui.frame_pending = true;
+}
+
+/* Widget changed; it is redrawn on the next frame if it is on screen */
+void ui_invalidate(struct ui_widget *w)
+{
+	w->dirty = true;
+	if (ui_widget_shown(w))
+		ui.frame_pending = true;
+}
+
+/* Framebuffer was changed directly; present it on the next frame */
+void ui_request_frame(void)
+{
+	ui.frame_pending = true;
+}
+
+uint32_t ui_get_frames(void)
+{
+	return ui.frames;
+}
+
+static void ui_widget_init(struct ui_widget *w, ui_draw_t draw, uint8_t x,
+			   uint8_t y, uint8_t width, uint8_t height)
+{
+	w->draw = draw;
+	w->x = x;
+	w->y = y;
+	w->w = width;
+	w->h = height;
+	w->dirty = true;
+	w->damaged = true;
+	w->next = NULL;
+}
+
+static void ui_text(uint8_t x, uint8_t y, const char *text,
+		    const font_def_t *font, oled_color_t color)
+{
+	ssd1306_set_cursor(&ui.cursor, x, y);
+	ssd1306_write_string(&ui.cursor, (char *)text, *font, color);
+}
+
+/* Label */
+
+static void ui_label_draw(struct ui_widget *w)
+{
+	struct ui_label *l = (struct ui_label *)w;
+
+	ui_clear(w);
+	ui_text(w->x, w->y, l->text, l->font, WHITE);
+}
+
+/**
+ * Set up text label.
+ *
+ * @param l Label object
+ * @param x Left column
+ * @param y Top row
+ * @param w Width to clear on change, pixels; 0: fit the initial text
+ * @param font Font
+ * @param text Initial text
+ */
+void ui_label_init(struct ui_label *l, uint8_t x, uint8_t y, uint8_t w,
+		   const font_def_t *font, const char *text)
+{
+	if (!w)
+		w = strlen(text) * font->font_width;
+
+	ui_widget_init(&l->base, ui_label_draw, x, y, w, font->font_height);
+	l->font = font;
+	strncpy(l->text, text, UI_TEXT_MAX);
+	l->text[UI_TEXT_MAX] = '\0';
+}
+
+void ui_label_set(struct ui_label *l, const char *text)
+{
+	if (!strncmp(l->text, text, UI_TEXT_MAX))
+		return;
+
+	strncpy(l->text, text, UI_TEXT_MAX);
+	l->text[UI_TEXT_MAX] = '\0';
+	ui_invalidate(&l->base);
+}
+
+/* Numeric field */
+
+/* "00" .. "99": two digits per division */
+static const char ui_digit_pairs[] =
+	"00010203040506070809" "10111213141516171819"
+	"20212223242526272829" "30313233343536373839"
+	"40414243444546474849" "50515253545556575859"
+	"60616263646566676869" "70717273747576777879"
+	"80818283848586878889" "90919293949596979899";
+
+/* Right-aligned decimal in cells, leading ones blank; v must fit */
+static void ui_number_format(char *str, uint8_t digits, uint32_t v)
+{
+	const char *pair;
+	int i = digits;
+
+	while (v >= 10) {
+		pair = &ui_digit_pairs[(v % 100) * 2];
+		str[--i] = pair[1];
+		str[--i] = pair[0];
+		v /= 100;
+	}
+	if (v || i == digits)
+		str[--i] = '0' + v;
+	while (i > 0)
+		str[--i] = ' ';
+}
+
+static void ui_number_draw(struct ui_widget *w)
+{
+	struct ui_number *n = (struct ui_number *)w;
+	char str[UI_TEXT_MAX];
+	uint8_t i;
+
+	if (!n->valid)
+		memset(str, '-', n->digits);
+	else
+		ui_number_format(str, n->digits, n->value);
+
+	if (w->damaged)
+		memset(n->shown, '\0', n->digits);
+
+	/* Glyph cells are opaque: redraw changed ones, leave the rest alone */
+	for (i = 0; i < n->digits; i++) {
+		if (str[i] == n->shown[i])
+			continue;
+		ssd1306_set_cursor(&ui.cursor, w->x + i * n->font->font_width,
+				   w->y);
+		ssd1306_write_char(&ui.cursor, str[i], *n->font, WHITE);
+		n->shown[i] = str[i];
+	}
+}
+
+void ui_number_init(struct ui_number *n, uint8_t x, uint8_t y, uint8_t digits,
+		    const font_def_t *font)
+{
+	uint8_t i;
+
+	/* Max is kept below 10^9 so it fits uint32_t */
+	if (digits > 9)
+		digits = 9;
+
+	ui_widget_init(&n->base, ui_number_draw, x, y,
+		       digits * font->font_width, font->font_height);
+	n->font = font;
+	n->digits = digits;
+	n->valid = false;
+	n->value = 0;
+	n->max = 1;
+	for (i = 0; i < digits; i++)
+		n->max *= 10;
+	n->max--;
+}
+
+/* Too big for the field: shows all nines rather than lower digits */
+void ui_number_set(struct ui_number *n, uint32_t value)
+{
+	if (value > n->max)
+		value = n->max;
+	if (n->valid && n->value == value)
+		return;
+
+	n->value = value;
+	n->valid = true;
+	ui_invalidate(&n->base);
+}
+
+/* Show dashes: no valid value */
+void ui_number_clear(struct ui_number *n)
+{
+	if (!n->valid)
+		return;
+
+	n->valid = false;
+	ui_invalidate(&n->base);
+}
+
+/* Icon */
+
+static void ui_icon_draw(struct ui_widget *w)
+{
+	struct ui_icon *i = (struct ui_icon *)w;
+
+	const oled_rect_t clip = {
+		w->x, w->y, w->x + w->w - 1, w->y + w->h - 1
+	};
+
+	if (i->bitmap)
+		ssd1306_blit(i->bitmap, w->x, w->y, WHITE, &clip);
+	else
+		ui_clear(w);
+}
+
+void ui_icon_init(struct ui_icon *i, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t h, const bitmap_def_t *bitmap)
+{
+	ui_widget_init(&i->base, ui_icon_draw, x, y, w, h);
+	i->bitmap = bitmap;
+}
+
+void ui_icon_set(struct ui_icon *i, const bitmap_def_t *bitmap)
+{
+	if (i->bitmap == bitmap)
+		return;
+
+	i->bitmap = bitmap;
+	ui_invalidate(&i->base);
+}
+
+/* Chart */
+
+static void ui_chart_draw(struct ui_widget *w)
+{
+	oled_chart_redraw(&((struct ui_chart *)w)->chart);
+}
+
+int ui_chart_init(struct ui_chart *c, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t h, uint16_t step)
+{
+	ui_widget_init(&c->base, ui_chart_draw, x, y, w, h);
+	return oled_chart_init(&c->chart, x, y, w, h, step);
+}
+
+/*
+ * Add sample. Chart on screen scrolls right away (that is cheaper than
+ * redrawing it on the frame tick); hidden one only stores the sample.
+ */
+void ui_chart_add(struct ui_chart *c, uint16_t value)
+{
+	if (ui_widget_shown(&c->base) && !c->base.dirty) {
+		oled_chart_add(&c->chart, value);
+		ui_request_frame();
+	} else {
+		oled_chart_push(&c->chart, value);
+	}
+}
+
+/* Menu */
+
+static void ui_menu_draw(struct ui_widget *w)
+{
+	struct ui_menu *m = (struct ui_menu *)w;
+	uint8_t row, item, y;
+
+	ui_clear(w);
+
+	for (row = 0; row < m->rows; row++) {
+		item = m->top + row;
+		if (item >= m->nr)
+			break;
+
+		y = w->y + row * m->font->font_height;
+		if (item == m->sel) {
+			ssd1306_fill_rectangle(w->x, y, w->x + w->w - 1,
+					       y + m->font->font_height - 1,
+					       WHITE);
+			ui_text(w->x, y, m->items[item], m->font, BLACK);
+		} else {
+			ui_text(w->x, y, m->items[item], m->font, WHITE);
+		}
+	}
+}
+
+void ui_menu_init(struct ui_menu *m, uint8_t x, uint8_t y, uint8_t w,
+		  uint8_t rows, const font_def_t *font,
+		  const char * const *items, uint8_t nr)
+{
+	ui_widget_init(&m->base, ui_menu_draw, x, y, w,
+		       rows * font->font_height);
+	m->font = font;
+	m->items = items;
+	m->nr = nr;
+	m->rows = rows;
+	m->top = 0;
+	m->sel = 0;
+}
+
+void ui_menu_select(struct ui_menu *m, uint8_t sel)
+{
+	if (sel >= m->nr || sel == m->sel)
+		return;
+
+	m->sel = sel;
+	/* Keep selection visible */
+	if (sel < m->top)
+		m->top = sel;
+	else if (sel >= m->top + m->rows)
+		m->top = sel - m->rows + 1;
+
+	ui_invalidate(&m->base);
+}
+
+/* Move selection by delta items, wrapping around */
+void ui_menu_move(struct ui_menu *m, int8_t delta)
+{
+	int sel;
+
+	if (!m->nr)
+		return;
+
+	sel = (m->sel + delta) % m->nr;
+	if (sel < 0)
+		sel += m->nr;
+	ui_menu_select(m, sel);
+}
@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+Font compiler: builds bit-packed, optionally run-length encoded SSD1306 fonts
+with only the characters the firmware needs.
+
+Each font is given as NAME=SOURCE[@CHARS]:
+  NAME    name of the generated font_def_t descriptor
+  SOURCE  table of src/ssd1306_fonts.c ("src/ssd1306_fonts.c:font16x26")
+          or BDF font file ("terminus.bdf")
+  CHARS   characters to keep (default: all printable ASCII, 32..126)
+
+Glyph storage (see font_read_column() in src/oled_ssd1306.c): columns left
+to right, each column top to bottom, one bit per pixel, LSB first, no
+padding between rows or columns; every glyph starts on a byte boundary.
+With RLE the same bit sequence is stored as alternating runs of 0s and 1s
+(starting with 0s) in 4-bit codes, low nibble first: code 15 adds 15 to the
+run and continues, code 0..14 ends it.
+
+Example:
+  tools/font_compiler.py -o src/ssd1306_fonts_packed.c --rle auto \\
+      'font_7x10=src/ssd1306_fonts.c:font7x10' \\
+      'font_16x26=src/ssd1306_fonts.c:font16x26@ 0123456789:CO'
+"""
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from font_pages import parse_fonts, FIRST_CHAR, LAST_CHAR  # noqa: E402
+
+# Limits of the renderer: column is decoded into 32 bits
+MAX_WIDTH = 32
+MAX_HEIGHT = 32
+ALL_CHARS = ''.join(chr(c) for c in range(FIRST_CHAR, LAST_CHAR + 1))
+
+
+class Font:
+    """Monospace font: glyphs are lists of rows, MSB is the leftmost pixel"""
+
+    def __init__(self, width, height, glyphs):
+        self.width = width
+        self.height = height
+        self.glyphs = glyphs    # char -> rows
+
+    def pixel(self, ch, row, col):
+        return (self.glyphs[ch][row] >> (self.width - 1 - col)) & 1
+
+
+def load_table(path, table):
+    with open(path) as f:
+        fonts = parse_fonts(f.read())
+    for name, width, height, rows in fonts:
+        if name != table:
+            continue
+        glyphs = {}
+        for ch in range(FIRST_CHAR, LAST_CHAR + 1):
+            idx = (ch - FIRST_CHAR) * height
+            glyphs[chr(ch)] = [r >> (16 - width) for r in rows[idx:idx + height]]
+        return Font(width, height, glyphs)
+    sys.exit('%s: no table %s' % (path, table))
+
+
+def load_bdf(path):
+    """Render BDF glyphs into cells of FONTBOUNDINGBOX size"""
+    glyphs = {}
+    fbb = None
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONTBOUNDINGBOX':
+            fbb = [int(v) for v in words[1:5]]
+        elif words[0] == 'STARTCHAR':
+            enc, bbx, bitmap = None, None, []
+            for line in lines:
+                words = line.split()
+                if words[0] == 'ENCODING':
+                    enc = int(words[1])
+                elif words[0] == 'BBX':
+                    bbx = [int(v) for v in words[1:5]]
+                elif words[0] == 'BITMAP':
+                    for line in lines:
+                        if line.startswith('ENDCHAR'):
+                            break
+                        bitmap.append(line.strip())
+                    break
+            if enc is None or bbx is None or not 0 <= enc < 256:
+                continue
+            fw, fh, fx, fy = fbb
+            w, h, x, y = bbx
+            rows = [0] * fh
+            top = (fh + fy) - (y + h)    # glyph top row in the cell
+            for r, hexrow in enumerate(bitmap):
+                bits = int(hexrow, 16)
+                nbits = len(hexrow) * 4
+                for c in range(w):
+                    if (bits >> (nbits - 1 - c)) & 1:
+                        cr, cc = top + r, x - fx + c
+                        if 0 <= cr < fh and 0 <= cc < fw:
+                            rows[cr] |= 1 << (fw - 1 - cc)
+            glyphs[chr(enc)] = rows
+    if fbb is None:
+        sys.exit('%s: no FONTBOUNDINGBOX' % path)
+    return Font(fbb[0], fbb[1], glyphs)
+
+
+def glyph_bits(font, ch):
+    return [font.pixel(ch, row, col)
+            for col in range(font.width) for row in range(font.height)]
+
+
+def pack_bits(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        if b:
+            out[i // 8] |= 1 << (i % 8)
+    return bytes(out)
+
+
+def pack_rle(bits):
+    runs, val, n = [], 0, 0
+    for b in bits:
+        if b == val:
+            n += 1
+        else:
+            runs.append(n)
+            val, n = b, 1
+    runs.append(n)
+
+    codes = []
+    for n in runs:
+        while n >= 15:
+            codes.append(15)
+            n -= 15
+        codes.append(n)
+
+    out = bytearray((len(codes) + 1) // 2)
+    for i, c in enumerate(codes):
+        out[i // 2] |= c << (4 * (i % 2))
+    return bytes(out)
+
+
+def compile_font(font, chars, rle):
+    missing = [c for c in chars if c not in font.glyphs]
+    if missing:
+        sys.exit('glyphs missing: %r' % ''.join(missing))
+    if font.width > MAX_WIDTH or font.height > MAX_HEIGHT:
+        sys.exit('font is too big: %dx%d' % (font.width, font.height))
+
+    raw = [pack_bits(glyph_bits(font, c)) for c in chars]
+    runs = [pack_rle(glyph_bits(font, c)) for c in chars]
+    if rle == 'auto':
+        use_rle = sum(map(len, runs)) < sum(map(len, raw))
+    else:
+        use_rle = rle == 'yes'
+    return (runs if use_rle else raw), use_rle, sum(map(len, raw))
+
+
+def c_string(s):
+    return '"' + ''.join('\\%s' % c if c in '"\\' else c for c in s) + '"'
+
+
+def emit(specs, rle):
+    out = ['/* Generated by tools/font_compiler.py, do not edit */',
+           '',
+           '#include "../inc/ssd1306_fonts.h"',
+           '']
+    report = []
+
+    for name, font, chars in specs:
+        glyphs, use_rle, raw_size = compile_font(font, chars, rle)
+        data, offsets = bytearray(), []
+        for g in glyphs:
+            offsets.append(len(data))
+            data += g
+        if len(data) > 0xffff:
+            sys.exit('%s: too much glyph data' % name)
+
+        flash = len(data) + 2 * len(offsets) + len(chars) + 1
+        report.append('%-16s %2dx%-2d %3d glyphs %5d bytes%s (rows: %d)' %
+                      (name, font.width, font.height, len(chars), flash,
+                       ', RLE' if use_rle else '',
+                       2 * font.height * len(chars)))
+
+        out.append('/* %s: %d bytes of glyphs%s, unpacked %d */' %
+                   (chars if chars != ALL_CHARS else 'ASCII 32..126',
+                    len(data), ' (RLE)' if use_rle else '', raw_size))
+        out.append('static const uint8_t %s_glyphs[] = {' % name)
+        for ch, g in zip(chars, glyphs):
+            for i in range(0, len(g), 12):
+                line = ', '.join('0x%02x' % b for b in g[i:i + 12])
+                if i == 0:
+                    line += ',\t/* %s */' % ('sp' if ch == ' ' else ch)
+                else:
+                    line += ','
+                out.append('\t' + line)
+        out.append('};')
+        out.append('')
+        out.append('static const uint16_t %s_offsets[] = {' % name)
+        for i in range(0, len(offsets), 10):
+            out.append('\t' + ', '.join('%d' % o for o in offsets[i:i + 10]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('font_def_t %s = {' % name)
+        out.append('\t.font_width = %d,' % font.width)
+        out.append('\t.font_height = %d,' % font.height)
+        out.append('\t.packed = %s_glyphs,' % name)
+        out.append('\t.offsets = %s_offsets,' % name)
+        if chars != ALL_CHARS:
+            out.append('\t.chars = %s,' % c_string(chars))
+        if use_rle:
+            out.append('\t.flags = FONT_RLE,')
+        out.append('};')
+        out.append('')
+
+    return '\n'.join(out), report
+
+
+def parse_spec(spec):
+    name, _, rest = spec.partition('=')
+    source, _, chars = rest.partition('@')
+    if not name or not source:
+        sys.exit('bad font spec: %s' % spec)
+
+    if source.lower().endswith('.bdf'):
+        font = load_bdf(source)
+    else:
+        path, _, table = source.rpartition(':')
+        font = load_table(path, table)
+
+    chars = chars or ALL_CHARS
+    # Keep order stable and drop duplicates
+    chars = ''.join(sorted(set(chars), key=ord))
+    return name, font, chars
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    ap.add_argument('-o', '--output', default='-', help='output C file')
+    ap.add_argument('--rle', choices=('no', 'yes', 'auto'), default='no',
+                    help='run-length encode glyphs (auto: if smaller)')
+    ap.add_argument('fonts', nargs='+', metavar='NAME=SOURCE[@CHARS]')
+    args = ap.parse_args()
+
+    text, report = emit([parse_spec(s) for s in args.fonts], args.rle)
+    if args.output == '-':
+        sys.stdout.write(text)
+    else:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    for line in report:
+        print(line, file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Convert row-major font tables of src/ssd1306_fonts.c into SSD1306 page layout.
+
+Source glyph: font_height rows of uint16_t, MSB is the leftmost pixel.
+Output glyph: ceil(font_height / 8) page rows of font_width bytes; bit 0 of a
+byte is the top pixel of the column, same as in the display RAM. So glyph
+bytes can be copied into the framebuffer as they are (with a shift when the
+glyph is not page-aligned).
+
+Usage: tools/font_pages.py [src/ssd1306_fonts.c] [src/ssd1306_fonts_pages.c]
+"""
+
+import re
+import sys
+
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+# name in ssd1306_fonts.c -> (width, height, include macro suffix)
+FONT_RE = re.compile(r'static const uint16_t (font(\d+)x(\d+))\s*\[\]\s*=\s*{(.*?)};',
+                     re.S)
+
+
+def parse_fonts(text):
+    fonts = []
+    for m in FONT_RE.finditer(text):
+        name, width, height, body = m.group(1), int(m.group(2)), int(m.group(3)), m.group(4)
+        body = re.sub(r'//[^\n]*', '', body)
+        rows = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+        nr = LAST_CHAR - FIRST_CHAR + 1
+        if len(rows) != nr * height:
+            sys.exit('%s: %d rows, expected %d' % (name, len(rows), nr * height))
+        fonts.append((name, width, height, rows))
+    return fonts
+
+
+def glyph_pages(rows, width, height):
+    """Rows of one glyph -> bytes in page layout"""
+    out = []
+    for page in range((height + 7) // 8):
+        for col in range(width):
+            byte = 0
+            for bit in range(8):
+                row = page * 8 + bit
+                if row < height and (rows[row] << col) & 0x8000:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def emit(fonts):
+    out = ['/* Generated by tools/font_pages.py from ssd1306_fonts.c, do not edit */',
+           '',
+           '#include "../inc/ssd1306_fonts.h"',
+           '']
+    for name, width, height, rows in fonts:
+        pages = (height + 7) // 8
+        out.append('#ifdef SSD1306_INCLUDE_FONT_%dx%d' % (width, height))
+        out.append('/* %d pages x %d columns per glyph */' % (pages, width))
+        out.append('const uint8_t %s_pages[] = {' % name)
+        for ch in range(FIRST_CHAR, LAST_CHAR + 1):
+            idx = (ch - FIRST_CHAR) * height
+            data = glyph_pages(rows[idx:idx + height], width, height)
+            out.append('\t/* %s */' % ('sp' if ch == 32 else chr(ch)))
+            for page in range(pages):
+                row = data[page * width:(page + 1) * width]
+                out.append('\t' + ', '.join('0x%02x' % b for b in row) + ',')
+        out.append('};')
+        out.append('#endif')
+        out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else 'src/ssd1306_fonts.c'
+    dst = sys.argv[2] if len(sys.argv) > 2 else 'src/ssd1306_fonts_pages.c'
+
+    with open(src) as f:
+        fonts = parse_fonts(f.read())
+    with open(dst, 'w') as f:
+        f.write(emit(fonts))
+
+
+if __name__ == '__main__':
+    main()
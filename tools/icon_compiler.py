@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""
+Icon compiler: converts PNG assets into SSD1306 page layout bitmaps, run-length
+encoded when that is smaller, for ssd1306_blit() (src/oled_ssd1306.c).
+
+Each icon is given as NAME=PNG:
+  NAME    name of the generated bitmap_def_t descriptor
+  PNG     image file; light pixels are lit (--invert: dark ones are)
+
+Bitmap storage: ceil(height / 8) pages of width bytes, bit 0 is the top pixel
+of the column, pages from top to bottom. With RLE the same byte stream is
+stored as PackBits-like runs:
+  0x00..0x7f  n + 1 literal bytes follow
+  0x80..0xff  next byte is repeated n - 125 times (3..130)
+
+Flash cost of every icon is printed to stderr.
+
+Example:
+  tools/icon_compiler.py -o src/ssd1306_icons.c -H inc/ssd1306_icons.h \\
+      icon_link=assets/icons/link.png icon_link_off=assets/icons/link_off.png
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+# Limits of bitmap_def_t
+MAX_SIZE = 255
+# bitmap_def_t: width, height, flags, pointer
+DESC_SIZE = 8
+
+PNG_SIG = b'\x89PNG\r\n\x1a\n'
+# Samples per pixel by color type
+PNG_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def load_png(path):
+    """Decode non-interlaced PNG into rows of (luma, alpha) pixels"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != PNG_SIG:
+        sys.exit('%s: not a PNG file' % path)
+
+    pos, idat, palette, trns = 8, b'', None, None
+    while pos < len(data):
+        length, ctype = struct.unpack('>I4s', data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b'IHDR':
+            width, height, depth, color, _, _, interlace = \
+                struct.unpack('>IIBBBBB', body)
+        elif ctype == b'PLTE':
+            palette = [body[i:i + 3] for i in range(0, len(body), 3)]
+        elif ctype == b'tRNS':
+            trns = body
+        elif ctype == b'IDAT':
+            idat += body
+        elif ctype == b'IEND':
+            break
+
+    if interlace or color not in PNG_CHANNELS or \
+       (depth < 8 and color not in (0, 3)):
+        sys.exit('%s: unsupported PNG format' % path)
+
+    bits = depth * PNG_CHANNELS[color]
+    bpp = max(1, bits // 8)
+    stride = (width * bits + 7) // 8
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    rows = []
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ftype == 2:
+                line[i] = (line[i] + prev[i]) & 0xff
+            elif ftype == 3:
+                line[i] = (line[i] + (a + prev[i]) // 2) & 0xff
+            elif ftype == 4:
+                line[i] = (line[i] + paeth(a, prev[i], c)) & 0xff
+        prev = line
+
+        # Samples, scaled to 8 bits
+        if depth < 8:
+            mask = (1 << depth) - 1
+            samples = [(line[(x * depth) // 8] >> (8 - depth - (x * depth) % 8))
+                       & mask for x in range(width)]
+        else:
+            step = depth // 8
+            samples = [line[i] for i in range(0, stride, step)]
+
+        row = []
+        n = PNG_CHANNELS[color]
+        for x in range(width):
+            if color == 3:
+                idx = samples[x]
+                r, g, b = palette[idx]
+                alpha = trns[idx] if trns and idx < len(trns) else 255
+                row.append(((r * 299 + g * 587 + b * 114) // 1000, alpha))
+                continue
+            px = samples[x * n:(x + 1) * n]
+            if color == 0 and depth < 8:
+                px = [px[0] * 255 // ((1 << depth) - 1)]
+            if color in (0, 4):
+                luma = px[0]
+            else:
+                luma = (px[0] * 299 + px[1] * 587 + px[2] * 114) // 1000
+            alpha = px[-1] if color in (4, 6) else 255
+            row.append((luma, alpha))
+        rows.append(row)
+
+    return width, height, rows
+
+
+def to_pages(width, height, rows, threshold, invert):
+    """Page layout bytes; transparent pixels are off"""
+    out = bytearray()
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            b = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y >= height:
+                    break
+                luma, alpha = rows[y][x]
+                lit = (luma < threshold) if invert else (luma >= threshold)
+                if lit and alpha >= 128:
+                    b |= 1 << bit
+            out.append(b)
+    return bytes(out)
+
+
+def pack_rle(data):
+    out = bytearray()
+    lit = bytearray()
+
+    def flush():
+        while lit:
+            chunk = lit[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del lit[:128]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 130:
+            run += 1
+        if run >= 3:
+            flush()
+            out.append(run + 125)
+            out.append(data[i])
+            i += run
+        else:
+            lit.append(data[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def compile_icon(name, path, rle, threshold, invert):
+    width, height, rows = load_png(path)
+    if not 0 < width <= MAX_SIZE or not 0 < height <= MAX_SIZE:
+        sys.exit('%s: icon is too big: %dx%d' % (path, width, height))
+    raw = to_pages(width, height, rows, threshold, invert)
+    packed = pack_rle(raw)
+    use_rle = rle == 'yes' or (rle == 'auto' and len(packed) < len(raw))
+    return {'name': name, 'path': path, 'width': width, 'height': height,
+            'raw': len(raw), 'data': packed if use_rle else raw,
+            'rle': use_rle}
+
+
+def emit_c(icons, table):
+    out = ['/* Generated by tools/icon_compiler.py, do not edit */',
+           '',
+           '#include "../inc/oled_ssd1306.h"',
+           '']
+    if table:
+        out[2:2] = ['#include <stddef.h>']
+    for icon in icons:
+        name, data = icon['name'], icon['data']
+        out.append('/* %s: %dx%d, %d bytes%s, unpacked %d */' %
+                   (os.path.basename(icon['path']), icon['width'],
+                    icon['height'], len(data), ' (RLE)' if icon['rle'] else '',
+                    icon['raw']))
+        out.append('static const uint8_t %s_data[] = {' % name)
+        for i in range(0, len(data), 12):
+            out.append('\t' + ', '.join('0x%02x' % b for b in data[i:i + 12]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('const bitmap_def_t %s = {' % name)
+        out.append('\t.width = %d,' % icon['width'])
+        out.append('\t.height = %d,' % icon['height'])
+        out.append('\t.data = %s_data,' % name)
+        if icon['rle']:
+            out.append('\t.flags = BITMAP_RLE,')
+        out.append('};')
+        out.append('')
+    if table:
+        out.append('/* All bitmaps above, NULL-terminated */')
+        out.append('const bitmap_def_t * const %s[] = {' % table)
+        out += ['\t&%s,' % icon['name'] for icon in icons]
+        out += ['\tNULL,', '};', '']
+        out.append('const char * const %s_names[] = {' % table)
+        out += ['\t"%s",' % icon['name'] for icon in icons]
+        out += ['\tNULL,', '};', '']
+    return '\n'.join(out)
+
+
+def emit_h(icons, path):
+    guard = os.path.basename(path).upper().replace('.', '_')
+    out = ['/* Generated by tools/icon_compiler.py, do not edit */',
+           '',
+           '#ifndef %s' % guard,
+           '#define %s' % guard,
+           '',
+           '#include "oled_ssd1306.h"',
+           '']
+    out += ['extern const bitmap_def_t %s;' % icon['name'] for icon in icons]
+    out += ['', '#endif /* %s */' % guard, '']
+    return '\n'.join(out)
+
+
+def write(path, text):
+    if path == '-':
+        sys.stdout.write(text)
+    else:
+        with open(path, 'w') as f:
+            f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n')[1])
+    ap.add_argument('-o', '--output', default='-', help='output C file')
+    ap.add_argument('-H', '--header', help='output header with declarations')
+    ap.add_argument('--rle', choices=('no', 'yes', 'auto'), default='auto',
+                    help='run-length encode icons (auto: if smaller)')
+    ap.add_argument('--threshold', type=int, default=128,
+                    help='luma at which a pixel is lit (0..255)')
+    ap.add_argument('--invert', action='store_true',
+                    help='dark pixels are lit')
+    ap.add_argument('--table', metavar='NAME',
+                    help='also emit NAME[] and NAME_names[] listing all icons')
+    ap.add_argument('icons', nargs='+', metavar='NAME=PNG')
+    args = ap.parse_args()
+
+    icons = []
+    for spec in args.icons:
+        name, _, path = spec.partition('=')
+        if not name or not path:
+            sys.exit('bad icon spec: %s' % spec)
+        icons.append(compile_icon(name, path, args.rle, args.threshold,
+                                  args.invert))
+
+    write(args.output, emit_c(icons, args.table))
+    if args.header:
+        write(args.header, emit_h(icons, args.header))
+
+    for icon in icons:
+        print('%-20s %3dx%-3d %4d bytes%s (page layout: %d)' %
+              (icon['name'], icon['width'], icon['height'],
+               len(icon['data']) + DESC_SIZE, ', RLE' if icon['rle'] else '',
+               icon['raw']), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()